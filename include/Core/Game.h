@@ -4,17 +4,25 @@
 #include <stack>
 #include <memory>
 #include "AudioSystem.h"
+#include "TextureCache.h"
 
 class GameState;
 
 class Game {
+public:
+    // paso fijo de actualizacion, la logica avanza siempre en incrementos iguales
+    static constexpr float FIXED_TIMESTEP = 1.0f / 60.0f;
+    static constexpr float MAX_FRAME_TIME = 0.25f;
+
 private:
     bool running;
     sf::RenderWindow window;
     sf::Font font;
     sf::Clock clock;
+    float accumulator;
     std::stack<std::shared_ptr<GameState>> states;
     AudioSystem audioSystem;
+    TextureCache textureCache;
 
 public:
     Game();
@@ -30,6 +38,7 @@ public:
     sf::RenderWindow& getWindow() { return window; }
     sf::Font& getFont() { return font; }
     AudioSystem& getAudioSystem() { return audioSystem; }
+    TextureCache& getTextureCache() { return textureCache; }
     float getMasterVolume() const { return audioSystem.getMasterVolume(); }
     void setMasterVolume(float volume) { audioSystem.setMasterVolume(volume); }
     float getMusicVolume() const { return audioSystem.getMusicVolume(); }
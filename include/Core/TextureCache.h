@@ -0,0 +1,19 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <string>
+#include <memory>
+
+// texturas compartidas por ruta: cada archivo se lee del disco y se sube a la gpu una sola vez
+// las referencias entregadas siguen siendo validas mientras exista el cache
+class TextureCache {
+private:
+    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures;
+    sf::Texture emptyTexture; // se entrega cuando un archivo no se pudo cargar
+
+public:
+    bool load(const std::string& filepath);
+    const sf::Texture& get(const std::string& filepath);
+    void clear();
+};
@@ -4,53 +4,133 @@
 #include <stdexcept>
 #include <algorithm>
 #include <initializer_list>
-
+#include <new>
+#include <cstring>
+#include <type_traits>
+#include "MemoryResource.h"
+
+// la memoria se reserva sin construir, solo existen objetos en [0, currentSize)
+// los tipos trivialmente copiables se trasladan con memcpy al crecer
+// la memoria sale de new global, o de un MemoryResource como una arena de temporales por paso
 template<typename T>
 class DynamicArray {
 private:
     T* data; // puntero a los datos del arreglo
     size_t capacity; // capacidad total del arreglo
     size_t currentSize; // tamano actual del arreglo
+    MemoryResource* resource; // origen de la memoria, nullptr para new global
 
-    // redimensiona el arreglo cuando se necesita mas espacio
-    void resize() {
-        capacity = capacity == 0 ? 1 : capacity * 2;
-        T* newData = new T[capacity];
-        for (size_t i = 0; i < currentSize; i++) {
-            newData[i] = std::move(data[i]);
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "DynamicArray no soporta tipos sobrealineados");
+
+    // reserva un bloque para count elementos sin construirlos
+    T* allocate(size_t count) {
+        if (count == 0) return nullptr;
+        if (resource) {
+            return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+
+
+    // libera un bloque de count elementos cuyos elementos ya fueron destruidos
+    void deallocate(T* block, size_t count) {
+        if (!block) return;
+        if (resource) {
+            resource->deallocate(block, count * sizeof(T), alignof(T));
+        } else {
+            ::operator delete(block);
+        }
+    }
+
+
+
+    // destruye los elementos en [first, last), nada que hacer para tipos triviales
+    void destroyRange(size_t first, size_t last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = first; i < last; i++) {
+                data[i].~T();
+            }
+        }
+    }
+
+
+
+    // copia los elementos de otro arreglo sobre memoria sin construir
+    void copyConstruct(T* target, const T* source, size_t count) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (count > 0) std::memcpy(static_cast<void*>(target), source, count * sizeof(T));
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                new (target + i) T(source[i]);
+            }
+        }
+    }
+
+
+
+    // traslada los elementos vivos a un bloque nuevo y libera el anterior
+    void relocate(T* newData, size_t newCapacity) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (currentSize > 0) std::memcpy(static_cast<void*>(newData), data, currentSize * sizeof(T));
+        } else {
+            for (size_t i = 0; i < currentSize; i++) {
+                new (newData + i) T(std::move(data[i]));
+                data[i].~T();
+            }
         }
-        delete[] data;
+        deallocate(data, capacity);
         data = newData;
+        capacity = newCapacity;
+    }
+
+
+
+    // capacidad siguiente cuando se necesita mas espacio
+    size_t grownCapacity() const {
+        return capacity == 0 ? 1 : capacity * 2;
     }
 
 
 
 public:
     // constructor por defecto
-    DynamicArray() : data(nullptr), capacity(0), currentSize(0) {}
+    DynamicArray() : data(nullptr), capacity(0), currentSize(0), resource(nullptr) {}
+
 
 
+    // constructor vacio que toma su memoria del recurso indicado
+    explicit DynamicArray(MemoryResource* resource) : data(nullptr), capacity(0), currentSize(0), resource(resource) {}
 
-    // constructor con tamano inicial
-    DynamicArray(size_t initialSize) : capacity(initialSize), currentSize(initialSize) {
-        data = new T[capacity];
+
+
+    // constructor con tamano inicial, los elementos se inicializan por defecto
+    DynamicArray(size_t initialSize, MemoryResource* resource = nullptr)
+        : data(nullptr), capacity(0), currentSize(0), resource(resource) {
+        resize(initialSize);
     }
 
 
 
-    // constructor de copia
-    DynamicArray(const DynamicArray& other) : capacity(other.capacity), currentSize(other.currentSize) {
-        data = new T[capacity];
-        for (size_t i = 0; i < currentSize; i++) {
-            data[i] = other.data[i];
-        }
+    // constructor de copia, la copia usa new global porque puede vivir mas que el recurso del original
+    DynamicArray(const DynamicArray& other) : DynamicArray(other, nullptr) {}
+
+
+
+    // constructor de copia hacia el recurso indicado
+    DynamicArray(const DynamicArray& other, MemoryResource* resource)
+        : data(nullptr), capacity(0), currentSize(0), resource(resource) {
+        data = allocate(other.currentSize);
+        capacity = other.currentSize;
+        currentSize = other.currentSize;
+        copyConstruct(data, other.data, currentSize);
     }
 
 
 
-    // constructor de movimiento
+    // constructor de movimiento, el bloque se lleva junto con su recurso
     DynamicArray(DynamicArray&& other) noexcept
-        : data(other.data), capacity(other.capacity), currentSize(other.currentSize) {
+        : data(other.data), capacity(other.capacity), currentSize(other.currentSize), resource(other.resource) {
         other.data = nullptr;
         other.capacity = 0;
         other.currentSize = 0;
@@ -58,23 +138,62 @@ public:
 
 
 
-    // destructor que libera la memoria
+    // destructor que destruye los elementos vivos y libera la memoria
     ~DynamicArray() {
-        delete[] data;
+        destroyRange(0, currentSize);
+        deallocate(data, capacity);
     }
 
 
 
-    // operador de asignacion por copia
+    // operador de asignacion por copia, reutiliza el bloque actual si alcanza
     DynamicArray& operator=(const DynamicArray& other) {
-        if (this != &other) {
-            delete[] data;
+        if (this == &other) return *this;
+
+        if (other.currentSize > capacity) {
+            destroyRange(0, currentSize);
+            deallocate(data, capacity);
+            data = allocate(other.currentSize);
+            capacity = other.currentSize;
+            currentSize = 0;
+        }
+
+        // asignar sobre los elementos que ya existen y construir o destruir el resto
+        size_t common = std::min(currentSize, other.currentSize);
+        for (size_t i = 0; i < common; i++) {
+            data[i] = other.data[i];
+        }
+        if (other.currentSize > currentSize) {
+            copyConstruct(data + currentSize, other.data + currentSize, other.currentSize - currentSize);
+        } else {
+            destroyRange(other.currentSize, currentSize);
+        }
+        currentSize = other.currentSize;
+        return *this;
+    }
+
+
+
+    // operador de asignacion por movimiento, toma el bloque del otro arreglo si comparten recurso
+    // con recursos distintos se mueven los elementos, asi un arreglo duradero nunca queda apuntando a una arena
+    DynamicArray& operator=(DynamicArray&& other) noexcept {
+        if (this != &other && resource != other.resource) {
+            clear();
+            reserve(other.currentSize);
+            for (size_t i = 0; i < other.currentSize; i++) {
+                new (data + i) T(std::move(other.data[i]));
+            }
+            currentSize = other.currentSize;
+            other.clear();
+        } else if (this != &other) {
+            destroyRange(0, currentSize);
+            deallocate(data, capacity);
+            data = other.data;
             capacity = other.capacity;
             currentSize = other.currentSize;
-            data = new T[capacity];
-            for (size_t i = 0; i < currentSize; i++) {
-                data[i] = other.data[i];
-            }
+            other.data = nullptr;
+            other.capacity = 0;
+            other.currentSize = 0;
         }
         return *this;
     }
@@ -83,31 +202,38 @@ public:
 
     // anade un elemento al final por copia
     void push_back(const T& value) {
-        if (currentSize >= capacity) {
-            resize();
-        }
-        data[currentSize++] = value;
+        emplace_back(value);
     }
 
 
 
     // anade un elemento al final por movimiento
     void push_back(T&& value) {
-        if (currentSize >= capacity) {
-            resize();
-        }
-        data[currentSize++] = std::move(value);
+        emplace_back(std::move(value));
     }
 
 
 
-    // construye un elemento al final
+    // construye un elemento al final directamente en su posicion
+    // al crecer se construye en el bloque nuevo antes de soltar el viejo, asi los argumentos pueden ser elementos propios
     template<typename... Args>
     void emplace_back(Args&&... args) {
-        if (currentSize >= capacity) {
-            resize();
+        if (currentSize < capacity) {
+            new (data + currentSize) T(std::forward<Args>(args)...);
+        } else {
+            size_t newCapacity = grownCapacity();
+            T* newData = allocate(newCapacity);
+            new (newData + currentSize) T(std::forward<Args>(args)...);
+            relocate(newData, newCapacity);
         }
-        data[currentSize++] = T(std::forward<Args>(args)...);
+        currentSize++;
+    }
+
+
+
+    // recurso del que sale la memoria, nullptr si es new global
+    MemoryResource* getResource() const {
+        return resource;
     }
 
 
@@ -126,8 +252,9 @@ public:
 
 
 
-    // limpia todos los elementos
+    // limpia todos los elementos, conserva la capacidad
     void clear() {
+        destroyRange(0, currentSize);
         currentSize = 0;
     }
 
@@ -177,17 +304,63 @@ public:
 
 
 
+    // elimina el ultimo elemento
+    void pop_back() {
+        if (currentSize == 0) return;
+        destroyRange(currentSize - 1, currentSize);
+        currentSize--;
+    }
+
+
+
     // elimina un elemento por indice
     void erase(size_t index) {
         if (index >= currentSize) return;
         for (size_t i = index; i < currentSize - 1; i++) {
             data[i] = std::move(data[i + 1]);
         }
+        destroyRange(currentSize - 1, currentSize);
         currentSize--;
     }
 
 
 
+    // elimina un elemento en tiempo constante moviendo el ultimo a su lugar, no conserva el orden
+    void swap_remove(size_t index) {
+        if (index >= currentSize) return;
+        size_t last = currentSize - 1;
+        if (index != last) {
+            data[index] = std::move(data[last]);
+        }
+        destroyRange(last, currentSize);
+        currentSize--;
+    }
+
+
+
+    // elimina en una sola pasada los elementos que cumplen el predicado, conserva el orden de los demas
+    // el predicado se llama una vez por elemento y en orden, puede actualizar el elemento antes de decidir
+    // retorna cuantos elementos se eliminaron
+    template<typename Predicate>
+    size_t erase_if(Predicate predicate) {
+        size_t kept = 0;
+        for (size_t i = 0; i < currentSize; i++) {
+            if (!predicate(data[i])) {
+                if (kept != i) {
+                    data[kept] = std::move(data[i]);
+                }
+                kept++;
+            }
+        }
+
+        size_t removed = currentSize - kept;
+        destroyRange(kept, currentSize);
+        currentSize = kept;
+        return removed;
+    }
+
+
+
     // iterador al inicio
     T* begin() { return data; }
 
@@ -208,26 +381,27 @@ public:
 
 
 
-    // reserva capacidad
+    // reserva capacidad sin construir elementos
     void reserve(size_t newCapacity) {
         if (newCapacity > capacity) {
-            T* newData = new T[newCapacity];
-            for (size_t i = 0; i < currentSize; i++) {
-                newData[i] = std::move(data[i]);
-            }
-            delete[] data;
-            data = newData;
-            capacity = newCapacity;
+            relocate(allocate(newCapacity), newCapacity);
         }
     }
 
 
 
-    // cambia el tamano del arreglo
+    // cambia el tamano del arreglo, los elementos nuevos se inicializan por defecto como con new T[]
     void resize(size_t newSize) {
         if (newSize > capacity) {
             reserve(newSize);
         }
+        if (newSize > currentSize) {
+            for (size_t i = currentSize; i < newSize; i++) {
+                new (data + i) T;
+            }
+        } else {
+            destroyRange(newSize, currentSize);
+        }
         currentSize = newSize;
     }
-};
\ No newline at end of file
+};
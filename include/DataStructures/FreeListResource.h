@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include "MemoryResource.h"
+#include "DynamicArray.h"
+
+// recicla bloques liberados en listas por tamano, para nodos que se crean y destruyen en cada oleada
+// los bloques no vuelven al sistema hasta destruir el recurso, que debe vivir mas que sus contenedores
+class FreeListResource : public MemoryResource {
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct SizeClass {
+        size_t bytes;
+        FreeBlock* head;
+    };
+
+    DynamicArray<SizeClass> classes;    // pocas clases, una por tamano distinto pedido
+    size_t fresh;                       // bloques pedidos al heap
+    size_t reused;                      // bloques entregados desde una lista libre
+
+    // busca la clase de un tamano, o la crea vacia
+    SizeClass& classFor(size_t bytes) {
+        for (SizeClass& sizeClass : classes) {
+            if (sizeClass.bytes == bytes) {
+                return sizeClass;
+            }
+        }
+        classes.push_back({bytes, nullptr});
+        return classes.back();
+    }
+
+
+
+    // tamano real de un bloque, debe poder guardar el enlace de la lista libre
+    static size_t blockBytes(size_t bytes) {
+        return bytes < sizeof(FreeBlock) ? sizeof(FreeBlock) : bytes;
+    }
+
+
+
+public:
+    FreeListResource() : fresh(0), reused(0) {}
+    FreeListResource(const FreeListResource&) = delete;
+    FreeListResource& operator=(const FreeListResource&) = delete;
+
+    ~FreeListResource() override {
+        for (SizeClass& sizeClass : classes) {
+            while (sizeClass.head) {
+                FreeBlock* next = sizeClass.head->next;
+                ::operator delete(sizeClass.head);
+                sizeClass.head = next;
+            }
+        }
+    }
+
+
+
+    // toma un bloque libre del mismo tamano si hay, si no lo pide al heap
+    void* allocate(size_t bytes, size_t) override {
+        bytes = blockBytes(bytes);
+        SizeClass& sizeClass = classFor(bytes);
+        if (sizeClass.head) {
+            FreeBlock* block = sizeClass.head;
+            sizeClass.head = block->next;
+            reused++;
+            return block;
+        }
+        fresh++;
+        return ::operator new(bytes);
+    }
+
+
+
+    // guarda el bloque en la lista de su tamano para el siguiente pedido
+    void deallocate(void* block, size_t bytes, size_t) override {
+        if (!block) return;
+        SizeClass& sizeClass = classFor(blockBytes(bytes));
+        FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->next = sizeClass.head;
+        sizeClass.head = freeBlock;
+    }
+
+
+
+    size_t getFreshCount() const { return fresh; }
+    size_t getReusedCount() const { return reused; }
+};
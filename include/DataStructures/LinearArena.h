@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include "MemoryResource.h"
+#include "DynamicArray.h"
+
+// arena lineal: cada pedido avanza un cursor dentro de un bloque y liberar no hace nada
+// reset devuelve todo de una vez, pensado para temporales que viven un solo paso
+// si un paso necesito varios bloques, reset los junta en uno solo y los pasos siguientes no piden memoria
+class LinearArena : public MemoryResource {
+private:
+    struct Block {
+        char* memory;
+        size_t size;
+    };
+
+    DynamicArray<Block> blocks;     // bloques en uso, el ultimo es el actual
+    size_t offset;                  // bytes ocupados del bloque actual
+    size_t blockSize;               // tamano minimo de un bloque nuevo
+    size_t used;                    // bytes entregados desde el ultimo reset
+    size_t highWater;               // maximo de bytes entregados entre dos resets
+
+    // agrega un bloque con espacio para al menos bytes
+    void addBlock(size_t bytes) {
+        size_t size = bytes > blockSize ? bytes : blockSize;
+        blocks.push_back({static_cast<char*>(::operator new(size)), size});
+        offset = 0;
+    }
+
+
+
+    // libera todos los bloques
+    void releaseBlocks() {
+        for (const Block& block : blocks) {
+            ::operator delete(block.memory);
+        }
+        blocks.clear();
+        offset = 0;
+    }
+
+
+
+public:
+    explicit LinearArena(size_t blockSize = 64 * 1024)
+        : offset(0), blockSize(blockSize), used(0), highWater(0) {}
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    ~LinearArena() override {
+        releaseBlocks();
+    }
+
+
+
+    // avanza el cursor respetando la alineacion, abre un bloque nuevo si no cabe
+    void* allocate(size_t bytes, size_t alignment) override {
+        if (!blocks.empty()) {
+            Block& block = blocks.back();
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.memory);
+            size_t aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+            if (aligned + bytes <= block.size) {
+                offset = aligned + bytes;
+                used += bytes;
+                return block.memory + aligned;
+            }
+        }
+
+        // los bloques de operator new ya vienen alineados para cualquier tipo normal
+        addBlock(bytes);
+        offset = bytes;
+        used += bytes;
+        return blocks.back().memory;
+    }
+
+
+
+    // la memoria se recupera en reset
+    void deallocate(void*, size_t, size_t) override {}
+
+
+
+    // descarta todo lo entregado, los arreglos que usaban la arena ya no deben tocarse
+    void reset() {
+        if (used > highWater) {
+            highWater = used;
+        }
+
+        // juntar los bloques en uno del tamano total para que el siguiente paso quepa sin pedir memoria
+        if (blocks.size() > 1) {
+            size_t total = 0;
+            for (const Block& block : blocks) {
+                total += block.size;
+            }
+            releaseBlocks();
+            addBlock(total);
+        }
+
+        offset = 0;
+        used = 0;
+    }
+
+
+
+    size_t getUsed() const { return used; }
+    size_t getHighWater() const { return used > highWater ? used : highWater; }
+    size_t getBlockCount() const { return blocks.size(); }
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+
+// origen de memoria intercambiable para DynamicArray
+// un arreglo sin recurso usa new y delete globales, con recurso pide y devuelve sus bloques a este
+class MemoryResource {
+public:
+    virtual ~MemoryResource() = default;
+
+    // entrega un bloque de al menos bytes con la alineacion pedida
+    virtual void* allocate(size_t bytes, size_t alignment) = 0;
+
+    // devuelve un bloque entregado por allocate con el mismo tamano y alineacion
+    virtual void deallocate(void* block, size_t bytes, size_t alignment) = 0;
+};
+
+
+
+// adaptador para usar un MemoryResource con contenedores de la biblioteca estandar
+template<typename T>
+class ResourceAllocator {
+public:
+    using value_type = T;
+
+    MemoryResource* resource;
+
+    explicit ResourceAllocator(MemoryResource* resource) : resource(resource) {}
+
+    template<typename U>
+    ResourceAllocator(const ResourceAllocator<U>& other) : resource(other.resource) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* block, size_t count) {
+        resource->deallocate(block, count * sizeof(T), alignof(T));
+    }
+
+    template<typename U>
+    bool operator==(const ResourceAllocator<U>& other) const { return resource == other.resource; }
+
+    template<typename U>
+    bool operator!=(const ResourceAllocator<U>& other) const { return resource != other.resource; }
+};
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// grupos de 8 valores de 32 bits que se operan juntos
+// con AVX2 son un registro, con SSE2 dos registros y sin extensiones un arreglo recorrido con ciclos
+// todas las variantes hacen las mismas operaciones en el mismo orden, sin fma, y dan los mismos bits
+// los kernels se escriben una sola vez contra esta interfaz
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GK_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GK_SIMD_SSE2 1
+#endif
+
+const int SIMD_LANES = 8;
+
+// cantidad redondeada hacia arriba a un multiplo de SIMD_LANES
+inline size_t lanePadded(size_t count) {
+    return (count + SIMD_LANES - 1) / SIMD_LANES * SIMD_LANES;
+}
+
+// nombre de la variante compilada, para reportes de rendimiento
+inline const char* simdLanesName() {
+#if defined(GK_SIMD_AVX2)
+    return "avx2";
+#elif defined(GK_SIMD_SSE2)
+    return "sse2";
+#else
+    return "escalar";
+#endif
+}
+
+// mascara por carril, todos los bits en uno donde la condicion se cumple
+struct MaskLanes {
+#if defined(GK_SIMD_AVX2)
+    __m256 v;
+#elif defined(GK_SIMD_SSE2)
+    __m128 lo, hi;
+#else
+    uint32_t v[SIMD_LANES];
+#endif
+};
+
+// 8 floats
+struct FloatLanes {
+#if defined(GK_SIMD_AVX2)
+    __m256 v;
+#elif defined(GK_SIMD_SSE2)
+    __m128 lo, hi;
+#else
+    float v[SIMD_LANES];
+#endif
+
+    static FloatLanes load(const float* source) {
+        FloatLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_loadu_ps(source);
+#elif defined(GK_SIMD_SSE2)
+        r.lo = _mm_loadu_ps(source);
+        r.hi = _mm_loadu_ps(source + 4);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = source[i];
+#endif
+        return r;
+    }
+
+    static FloatLanes fill(float value) {
+        FloatLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_set1_ps(value);
+#elif defined(GK_SIMD_SSE2)
+        r.lo = r.hi = _mm_set1_ps(value);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = value;
+#endif
+        return r;
+    }
+
+    // lee base[index[i]] en cada carril
+    static FloatLanes gather(const float* base, const int* index) {
+        FloatLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index)), 4);
+#elif defined(GK_SIMD_SSE2)
+        r.lo = _mm_set_ps(base[index[3]], base[index[2]], base[index[1]], base[index[0]]);
+        r.hi = _mm_set_ps(base[index[7]], base[index[6]], base[index[5]], base[index[4]]);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = base[index[i]];
+#endif
+        return r;
+    }
+
+    void store(float* target) const {
+#if defined(GK_SIMD_AVX2)
+        _mm256_storeu_ps(target, v);
+#elif defined(GK_SIMD_SSE2)
+        _mm_storeu_ps(target, lo);
+        _mm_storeu_ps(target + 4, hi);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) target[i] = v[i];
+#endif
+    }
+};
+
+// operaciones elemento a elemento
+inline FloatLanes operator+(FloatLanes a, FloatLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_add_ps(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_add_ps(a.lo, b.lo);
+    a.hi = _mm_add_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] + b.v[i];
+#endif
+    return a;
+}
+
+inline FloatLanes operator-(FloatLanes a, FloatLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_sub_ps(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_sub_ps(a.lo, b.lo);
+    a.hi = _mm_sub_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] - b.v[i];
+#endif
+    return a;
+}
+
+inline FloatLanes operator*(FloatLanes a, FloatLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_mul_ps(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_mul_ps(a.lo, b.lo);
+    a.hi = _mm_mul_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] * b.v[i];
+#endif
+    return a;
+}
+
+// minimo y maximo con la semantica de minps/maxps: ante empate o NaN gana el segundo
+inline FloatLanes lanesMin(FloatLanes a, FloatLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_min_ps(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_min_ps(a.lo, b.lo);
+    a.hi = _mm_min_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+#endif
+    return a;
+}
+
+inline FloatLanes lanesMax(FloatLanes a, FloatLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_max_ps(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_max_ps(a.lo, b.lo);
+    a.hi = _mm_max_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+#endif
+    return a;
+}
+
+// valor absoluto limpiando el bit de signo
+inline FloatLanes lanesAbs(FloatLanes a) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v);
+#elif defined(GK_SIMD_SSE2)
+    __m128 sign = _mm_set1_ps(-0.0f);
+    a.lo = _mm_andnot_ps(sign, a.lo);
+    a.hi = _mm_andnot_ps(sign, a.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] < 0.0f ? -a.v[i] : a.v[i];
+#endif
+    return a;
+}
+
+// a < b por carril
+inline MaskLanes lanesLess(FloatLanes a, FloatLanes b) {
+    MaskLanes m;
+#if defined(GK_SIMD_AVX2)
+    m.v = _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ);
+#elif defined(GK_SIMD_SSE2)
+    m.lo = _mm_cmplt_ps(a.lo, b.lo);
+    m.hi = _mm_cmplt_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) m.v[i] = a.v[i] < b.v[i] ? 0xFFFFFFFFu : 0u;
+#endif
+    return m;
+}
+
+// toma whenTrue donde la mascara esta activa y whenFalse en el resto
+inline FloatLanes lanesSelect(MaskLanes mask, FloatLanes whenTrue, FloatLanes whenFalse) {
+    FloatLanes r;
+#if defined(GK_SIMD_AVX2)
+    r.v = _mm256_blendv_ps(whenFalse.v, whenTrue.v, mask.v);
+#elif defined(GK_SIMD_SSE2)
+    r.lo = _mm_or_ps(_mm_and_ps(mask.lo, whenTrue.lo), _mm_andnot_ps(mask.lo, whenFalse.lo));
+    r.hi = _mm_or_ps(_mm_and_ps(mask.hi, whenTrue.hi), _mm_andnot_ps(mask.hi, whenFalse.hi));
+#else
+    for (int i = 0; i < SIMD_LANES; i++) r.v[i] = mask.v[i] ? whenTrue.v[i] : whenFalse.v[i];
+#endif
+    return r;
+}
+
+inline MaskLanes operator|(MaskLanes a, MaskLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_or_ps(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_or_ps(a.lo, b.lo);
+    a.hi = _mm_or_ps(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] | b.v[i];
+#endif
+    return a;
+}
+
+// un bit por carril, el bit i corresponde al carril i
+inline int lanesBits(MaskLanes mask) {
+#if defined(GK_SIMD_AVX2)
+    return _mm256_movemask_ps(mask.v);
+#elif defined(GK_SIMD_SSE2)
+    return _mm_movemask_ps(mask.lo) | (_mm_movemask_ps(mask.hi) << 4);
+#else
+    int bits = 0;
+    for (int i = 0; i < SIMD_LANES; i++) bits |= (mask.v[i] ? 1 : 0) << i;
+    return bits;
+#endif
+}
+
+// 8 enteros sin signo de 32 bits, con lo necesario para generadores xoshiro
+struct UintLanes {
+#if defined(GK_SIMD_AVX2)
+    __m256i v;
+#elif defined(GK_SIMD_SSE2)
+    __m128i lo, hi;
+#else
+    uint32_t v[SIMD_LANES];
+#endif
+
+    static UintLanes load(const uint32_t* source) {
+        UintLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+#elif defined(GK_SIMD_SSE2)
+        r.lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        r.hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 4));
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = source[i];
+#endif
+        return r;
+    }
+
+    static UintLanes fill(uint32_t value) {
+        UintLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_set1_epi32(static_cast<int>(value));
+#elif defined(GK_SIMD_SSE2)
+        r.lo = r.hi = _mm_set1_epi32(static_cast<int>(value));
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = value;
+#endif
+        return r;
+    }
+
+    void store(uint32_t* target) const {
+#if defined(GK_SIMD_AVX2)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target), v);
+#elif defined(GK_SIMD_SSE2)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + 4), hi);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) target[i] = v[i];
+#endif
+    }
+
+    // valores menores a 2^31 convertidos a float
+    FloatLanes toFloat() const {
+        FloatLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_cvtepi32_ps(v);
+#elif defined(GK_SIMD_SSE2)
+        r.lo = _mm_cvtepi32_ps(lo);
+        r.hi = _mm_cvtepi32_ps(hi);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = static_cast<float>(static_cast<int32_t>(v[i]));
+#endif
+        return r;
+    }
+
+    // los 24 bits altos como float exacto en [0, 1), igual que RandomStream::nextFloat
+    FloatLanes toUnitFloat() const {
+        FloatLanes r;
+#if defined(GK_SIMD_AVX2)
+        r.v = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(v, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+#elif defined(GK_SIMD_SSE2)
+        __m128 scale = _mm_set1_ps(1.0f / 16777216.0f);
+        r.lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(lo, 8)), scale);
+        r.hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(hi, 8)), scale);
+#else
+        for (int i = 0; i < SIMD_LANES; i++) r.v[i] = static_cast<float>(v[i] >> 8) * (1.0f / 16777216.0f);
+#endif
+        return r;
+    }
+};
+
+inline UintLanes operator+(UintLanes a, UintLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_add_epi32(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_add_epi32(a.lo, b.lo);
+    a.hi = _mm_add_epi32(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] + b.v[i];
+#endif
+    return a;
+}
+
+inline UintLanes operator^(UintLanes a, UintLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_xor_si256(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_xor_si128(a.lo, b.lo);
+    a.hi = _mm_xor_si128(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] ^ b.v[i];
+#endif
+    return a;
+}
+
+inline UintLanes operator&(UintLanes a, UintLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_and_si256(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_and_si128(a.lo, b.lo);
+    a.hi = _mm_and_si128(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] & b.v[i];
+#endif
+    return a;
+}
+
+inline UintLanes operator|(UintLanes a, UintLanes b) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_or_si256(a.v, b.v);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_or_si128(a.lo, b.lo);
+    a.hi = _mm_or_si128(a.hi, b.hi);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] | b.v[i];
+#endif
+    return a;
+}
+
+// desplazamientos con cantidad fija, las instrucciones la necesitan como constante
+template<int Bits>
+inline UintLanes shiftLeft(UintLanes a) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_slli_epi32(a.v, Bits);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_slli_epi32(a.lo, Bits);
+    a.hi = _mm_slli_epi32(a.hi, Bits);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] << Bits;
+#endif
+    return a;
+}
+
+template<int Bits>
+inline UintLanes shiftRight(UintLanes a) {
+#if defined(GK_SIMD_AVX2)
+    a.v = _mm256_srli_epi32(a.v, Bits);
+#elif defined(GK_SIMD_SSE2)
+    a.lo = _mm_srli_epi32(a.lo, Bits);
+    a.hi = _mm_srli_epi32(a.hi, Bits);
+#else
+    for (int i = 0; i < SIMD_LANES; i++) a.v[i] = a.v[i] >> Bits;
+#endif
+    return a;
+}
+
+template<int Bits>
+inline UintLanes rotateLeft(UintLanes a) {
+    return shiftLeft<Bits>(a) | shiftRight<32 - Bits>(a);
+}
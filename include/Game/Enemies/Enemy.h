@@ -1,46 +1,61 @@
 #pragma once
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <string>
 #include "../include/DataStructures/DynamicArray.h"
 #include "../include/Game/Genetics/Chromosome.h"
+#include "../include/Game/Systems/SimulationEvent.h"
+#include "../include/Game/Systems/SimClock.h"
+#include "../include/Game/Enemies/EnemyStore.h"
+#include <memory>
 
-struct FloatingDamageText {
-    sf::Text text;
-    sf::Clock timer;
-
-    FloatingDamageText() {
-        timer.restart();
-    }
+// tipos de enemigo, usados por la capa visual para elegir sprite
+enum class EnemyType {
+    Ogre,
+    DarkElf,
+    Harpy,
+    Mercenary
 };
 
-class AudioSystem;
+const int ENEMY_TYPE_COUNT = 4;
 
-class Enemy : public sf::Drawable {
-protected:
-    int id;
+// un impacto pendiente de aplicar, para entregar varios golpes en una sola llamada
+struct DamageHit {
+    class Enemy* target;
+    float amount;
+    DamageType type;
+};
+
+// atributos iniciales de un enemigo, cada tipo los calcula a partir del cromosoma y la oleada
+struct EnemyStats {
     float health;
-    float maxHealth;
     float speed;
-    sf::Vector2f position;
-    sf::Vector2f direction;
     float arrowResistance;
     float magicResistance;
     float artilleryResistance;
     int goldReward;
-    sf::Sprite sprite;
-    sf::Texture texture;
-    bool isActive;
+};
+
+// datos frios del enemigo, el estado que se actualiza cada paso vive en una fila de EnemyStore
+// mientras no pertenece a una simulacion el enemigo usa un almacen propio de una sola fila
+class Enemy {
+protected:
+    friend class EnemyStore;
+    friend class EnemyPool;
+
+    int id;
+    EnemyType enemyType;
+    int goldReward;
     DynamicArray<sf::Vector2f> path;
-    size_t currentPathIndex;
-    float totalDistanceTraveled;
-    float totalDamageReceived;
-    sf::Clock lifeTimer;
-    DynamicArray<FloatingDamageText> floatingTexts;
-    static sf::Font sharedFont;
-    static AudioSystem* audioSystem;
+    SimTimer lifeTimer;
+    SimulationEventQueue* events;
+    std::unique_ptr<EnemyStore> ownStore;
+    EnemyStore* store;
+    size_t slot;
 
 public:
     Enemy(
+        EnemyType type,
         float health,
         float speed,
         float arrowRes,
@@ -51,35 +66,50 @@ public:
         const DynamicArray<sf::Vector2f>& path);
 
     Enemy(
+        EnemyType type,
+        const EnemyStats& stats,
+        const sf::Vector2f& position,
+        const DynamicArray<sf::Vector2f>& path);
+
+    Enemy(
+        EnemyType type,
         const Chromosome& chromosome,
         int goldReward,
         const sf::Vector2f& position,
         const DynamicArray<sf::Vector2f>& path);
 
-    virtual ~Enemy() = default;
-    virtual void update(float dt);
-    virtual void takeDamage(float amount, const std::string& damageType);
-    bool loadTexture(const std::string& filename);
+    Enemy(const Enemy&) = delete;
+    Enemy& operator=(const Enemy&) = delete;
+    virtual ~Enemy();
+
+    // reinicia un enemigo reciclado por EnemyPool como si se acabara de construir
+    virtual void respawn(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path, const Chromosome& chromosome, int waveNumber);
+
+    void update(float dt);
+    void takeDamage(float amount, DamageType damageType);
+    static void applyDamage(const DynamicArray<DamageHit>& hits);
     bool isAlive() const;
     bool hasReachedEnd() const;
     void setPath(const DynamicArray<sf::Vector2f>& newPath);
+    bool isPathThrough(const sf::Vector2f& point) const;
     void recalculatePath(class Grid* grid, const sf::Vector2f& goal);
     int getGoldReward() const;
     sf::Vector2f getPosition() const;
+    EnemyType getType() const;
+    float getHealthPercentage() const;
     int getId() const;
     void setId(int id);
     float getTotalDistanceTraveled() const;
     float getTotalDamageReceived() const;
     float getTimeAlive() const;
     float getDamageEffectiveness() const;
-    virtual void receiveDamage(float damage);
-    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
-    static void setSharedFont(const sf::Font& font);
-    static void setAudioSystem(AudioSystem* audio);
+    void receiveDamage(float damage);
+    void setEventQueue(SimulationEventQueue* queue);
+    void setClock(const SimClock* clock);
 
 protected:
-    void updateFloatingTexts(float dt);
-    void createDamageText(float damage);
-    void updateMovement(float dt);
+    void reinitialize(const EnemyStats& stats, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& newPath);
+    void initializeState(float health, float speed, float arrowRes, float magicRes, float artilleryRes, const sf::Vector2f& position);
+    void setMovementPasses(int passes);
     void trackDamage(float damage);
-};
\ No newline at end of file
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Enemies/Enemy.h"
+#include "../include/Game/Enemies/EnemyStore.h"
+
+// recicla enemigos de la simulacion para que aparecer y morir no pidan ni liberen memoria
+// los enemigos libres se guardan por tipo y conservan la capacidad de su camino
+// las filas de EnemyStore se quitan con intercambio, los punteros a Enemy son los manejadores estables
+class EnemyPool {
+private:
+    EnemyStore& store;
+    DynamicArray<std::unique_ptr<Enemy>> freeEnemies[ENEMY_TYPE_COUNT];
+    size_t inUse;                   // enemigos en la simulacion
+    size_t highWater;               // maximo de enemigos simultaneos desde el ultimo reinicio
+    size_t created;                 // enemigos nuevos adoptados, sin contar reciclados
+    size_t recycled;                // enemigos entregados desde las listas libres
+
+public:
+    explicit EnemyPool(EnemyStore& store);
+    EnemyPool(const EnemyPool&) = delete;
+    EnemyPool& operator=(const EnemyPool&) = delete;
+
+    // entrega un enemigo libre del tipo dado ya reiniciado en el almacen, o nullptr si no hay
+    std::unique_ptr<Enemy> acquire(EnemyType type, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path,
+                                   const Chromosome& chromosome, int waveNumber);
+
+    // registra un enemigo que entra a la simulacion, nuevo o reciclado
+    void adopt(Enemy& enemy);
+
+    // saca al enemigo de la simulacion y lo guarda para reutilizarlo
+    void release(std::unique_ptr<Enemy> enemy);
+
+    size_t getInUse() const { return inUse; }
+    size_t getHighWater() const { return highWater; }
+    size_t getCreated() const { return created; }
+    size_t getRecycled() const { return recycled; }
+    size_t getFreeCount() const;
+    void resetHighWater() { highWater = inUse; }
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include "../include/DataStructures/DynamicArray.h"
+
+class Enemy;
+
+// tipos de dano de las torres, indexan la tabla de resistencias del enemigo
+enum class DamageType {
+    Arrow,
+    Magic,
+    Artillery,
+    Count
+};
+
+const int DAMAGE_TYPE_COUNT = static_cast<int>(DamageType::Count);
+
+// estado caliente de los enemigos guardado por columnas (estructura de arreglos)
+// movimiento, seleccion de objetivos y dano recorren arreglos contiguos en lugar de objetos dispersos
+// la fila de cada enemigo coincide con su posicion en la lista de la simulacion
+// al quitar un enemigo la ultima fila ocupa su lugar, igual que en la lista
+class EnemyStore {
+private:
+    friend class Enemy;
+    friend class EnemyPool;
+
+    DynamicArray<sf::Vector2f> positions;
+    DynamicArray<sf::Vector2f> directions;
+    DynamicArray<float> speeds;
+    DynamicArray<float> health;
+    DynamicArray<float> maxHealth;
+    DynamicArray<float> resistances[DAMAGE_TYPE_COUNT];
+    DynamicArray<size_t> pathIndices;
+    DynamicArray<const DynamicArray<sf::Vector2f>*> paths;
+    DynamicArray<uint8_t> active;
+    DynamicArray<uint8_t> movementPasses;   // avances por paso, los tipos concretos avanzan dos veces
+    DynamicArray<float> distanceTraveled;
+    DynamicArray<float> damageReceived;
+    DynamicArray<Enemy*> owners;            // enemigo duenio de cada fila, para corregir su fila al compactar
+
+    static constexpr float ARRIVAL_THRESHOLD = 5.0f; // distancia para dar por alcanzado un punto del camino
+
+    size_t addRow(Enemy* owner, const DynamicArray<sf::Vector2f>* path);
+    void copyRow(size_t slot, const EnemyStore& from, size_t fromSlot);
+    void removeRow(size_t slot);
+    void movePass(size_t slot, float dt);
+
+public:
+    EnemyStore() = default;
+    EnemyStore(const EnemyStore&) = delete;
+    EnemyStore& operator=(const EnemyStore&) = delete;
+
+    // mueve la fila del enemigo a este almacen, al final
+    void attach(Enemy& enemy);
+
+    // avanza a todos los enemigos activos a lo largo de su camino
+    void advance(float dt);
+    void advanceSlot(size_t slot, float dt);
+
+    const DynamicArray<sf::Vector2f>& getPositions() const { return positions; }
+    size_t size() const { return owners.size(); }
+    bool empty() const { return owners.empty(); }
+};
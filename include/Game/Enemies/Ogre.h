@@ -8,6 +8,5 @@ public:
     Ogre(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path);
     Ogre(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path, const Chromosome& chromosome, int waveNumber);
 
-    void update(float dt) override;
-    void takeDamage(float amount, const std::string& damageType) override;
+    void respawn(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path, const Chromosome& chromosome, int waveNumber) override;
 };
\ No newline at end of file
@@ -1,21 +1,25 @@
 #pragma once
 
 #include <random>
+#include "../include/Game/Systems/RandomService.h"
 
 class Chromosome {
 public:
   Chromosome();
+  explicit Chromosome(RandomStream& rng);
   Chromosome(float health, float speed, float arrowRes, float magicRes, float artilleryRes);
   Chromosome(const Chromosome& other);
   void calculateFitness(bool reachedEnd, float distanceTraveled, float damageDealt, float timeAlive, float pathTotalLength = 1000.0f);
-  Chromosome crossover(const Chromosome& other) const;
-  void mutate(float mutationRate);
+  Chromosome crossover(const Chromosome& other, RandomStream& rng) const;
+  void mutate(float mutationRate, RandomStream& rng);
   float getHealth() const;
   float getSpeed() const;
   float getArrowResistance() const;
   float getMagicResistance() const;
   float getArtilleryResistance() const;
   float getFitness() const;
+  void setFitness(float value);
+  static float mutationFactor(float fitness);
   float calculateDiversity(const Chromosome& other) const;
   bool isValid() const;
   void clampValues();
@@ -27,5 +31,4 @@ private:
   float magicResistance;
   float artilleryResistance;
   float fitness;
-  static std::mt19937 randomGenerator;
 };
\ No newline at end of file
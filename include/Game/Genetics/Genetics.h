@@ -1,20 +1,41 @@
 #pragma once
 
 #include "Chromosome.h"
+#include "PopulationStore.h"
+#include "RouletteTable.h"
 #include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Systems/RandomService.h"
 #include <random>
 
+// como se sortean los hijos de cada generacion
+enum class BreedingMode {
+    Sequential,     // un hijo a la vez con las distribuciones de <random>, misma secuencia que Chromosome
+    Batch           // de a SIMD_LANES hijos con generadores por carriles, otra secuencia pero mucho mas rapido
+};
+
+// como se giran los padres en la seleccion por ruleta
+enum class SelectionStrategy {
+    Roulette,               // un giro por padre con busqueda binaria, misma secuencia que recorrer la poblacion
+    Alias,                  // un giro por padre en O(1) con la tabla de alias
+    StochasticUniversal     // un solo giro y punteros equidistantes, menos varianza que girar por padre
+};
+
+// la poblacion vive en dos almacenes por columnas: el actual y el de la siguiente generacion
+// cada generacion se escribe en el otro almacen y luego se intercambian los punteros, sin copiar individuos
 class Genetics {
 public:
-    Genetics(int populationSize, float mutationRate, float crossoverRate);
+    Genetics(int populationSize, float mutationRate, float crossoverRate, RandomService& random);
+    Genetics(const Genetics&) = delete;
+    Genetics& operator=(const Genetics&) = delete;
 
     void initializePopulation();
     void evaluatePopulation(const DynamicArray<bool>& reachedEnd, const DynamicArray<float>& distancesTraveled, const DynamicArray<float>& damagesDealt, const DynamicArray<float>& timesAlive);
-    DynamicArray<Chromosome> selectParents();
+    DynamicArray<Chromosome> selectParents(MemoryResource* resource = nullptr);
     void createNextGeneration();
     Chromosome getBestChromosome() const;
-    DynamicArray<Chromosome> getChromosomesForWave(int count);
-    DynamicArray<float> getCurrentFitnessScores() const;
+    DynamicArray<Chromosome> getChromosomesForWave(int count, MemoryResource* resource = nullptr);
+    DynamicArray<float> getCurrentFitnessScores(MemoryResource* resource = nullptr) const;
+    const PopulationStore& getPopulation() const { return *population; }
     float getAverageFitness() const;
     float getDiversityMetric() const;
     bool hasConverged() const;
@@ -25,16 +46,37 @@ public:
     void adaptParameters();
     void maintainDiversity();
     void resetPopulationIfStagnant();
+    void setScratchMemory(MemoryResource* resource);
+    void setBreedingMode(BreedingMode mode);
+    BreedingMode getBreedingMode() const { return breedingMode; }
+    void setSelectionStrategy(SelectionStrategy strategy);
+    SelectionStrategy getSelectionStrategy() const { return selectionStrategy; }
 
 private:
-    DynamicArray<Chromosome> population;
+    PopulationStore generations[2];
+    PopulationStore* population;        // generacion actual
+    PopulationStore* nextPopulation;    // destino de la siguiente generacion
+    DynamicArray<int> parentRows;       // filas elegidas como padres, reutilizado
+    DynamicArray<int> orderRows;        // filas ordenadas por fitness, reutilizado
+    RouletteTable roulette;             // ruleta de la generacion actual, reutilizada
+    BreedingPlan breedingPlan;          // decisiones aleatorias de los hijos, reutilizado
     int populationSize;
     float mutationRate;
     float crossoverRate;
     int generation;
     int mutationCount;
     float pathTotalLength;
-    std::mt19937 randomGenerator;
+    RandomStream& randomGenerator;
+    RandomStream& chromosomeRandom;
+    RandomStream& breedingStream;       // siembra los carriles en cada generacion
+    LaneRandom breedingRandom;
+    BreedingMode breedingMode;
+    SelectionStrategy selectionStrategy;
     float averageDiversity;
     float convergenceThreshold;
+    MemoryResource* scratch;        // memoria para temporales de cada generacion, nullptr usa el heap
+
+    void selectParentRows(DynamicArray<int>& rows);
+    void planOffspring(const DynamicArray<int>& parents, size_t count);
+    void sortPopulationByFitness();
 };
\ No newline at end of file
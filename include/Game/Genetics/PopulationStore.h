@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Genetics/Chromosome.h"
+#include "../include/Game/Systems/LaneRandom.h"
+
+// genes del cromosoma, indexan las columnas de la poblacion
+enum class Gene {
+    Health,
+    Speed,
+    ArrowResistance,
+    MagicResistance,
+    ArtilleryResistance,
+    Count
+};
+
+const int GENE_COUNT = static_cast<int>(Gene::Count);
+
+class PopulationStore;
+
+// decisiones aleatorias de cada hijo de una generacion, tomadas antes de tocar los genes
+// asi el cruzamiento y la mutacion recorren columnas completas sin consumir aleatoriedad
+// las columnas se rellenan hasta un multiplo de SIMD_LANES con hijos neutros para procesar
+// bloques completos de carriles, los hijos de relleno nunca se escriben en la poblacion
+//
+// el cruce de cada gen es clamp(a * weight + b * (1 - weight)) si gen >= crossPoint, y b si no
+// a y b son los genes del primer y segundo padre, con eso se expresan las tres formas de cruzar:
+//   copia del primer padre: weight 1, crossPoint 0
+//   aritmetico:             weight en [0.2, 0.8], crossPoint 0
+//   un punto:               weight 1, crossPoint 1 a 4 (genes tomados del segundo padre)
+struct BreedingPlan {
+    DynamicArray<int> firstParent;                  // fila del primer padre en la poblacion actual
+    DynamicArray<int> secondParent;                 // fila del segundo padre
+    DynamicArray<float> weight;                     // peso del primer padre
+    DynamicArray<float> crossPoint;                 // genes iniciales que vienen del segundo padre
+    DynamicArray<float> mutation[GENE_COUNT];       // cambio de cada gen, cero si no muta
+    DynamicArray<float> fitness;                    // fitness con el que nace el hijo
+    size_t count = 0;
+
+    // prepara el plan para childCount hijos, todos neutros: copia sin mutacion
+    void resize(size_t childCount);
+    size_t size() const { return count; }
+
+    // sortea childCount hijos de a SIMD_LANES eligiendo padres entre las filas parents de population
+    // Genetics::planOffspring es la version uno a uno que reproduce Chromosome::crossover y mutate
+    void drawBatch(LaneRandom& random, const DynamicArray<int>& parents, const PopulationStore& population,
+                   float crossoverRate, float mutationRate, size_t childCount);
+};
+
+// poblacion del algoritmo genetico guardada por columnas (estructura de arreglos)
+// cada gen y el fitness son arreglos contiguos, la fila i es el individuo i
+class PopulationStore {
+private:
+    DynamicArray<float> genes[GENE_COUNT];
+    DynamicArray<float> fitness;
+
+public:
+    PopulationStore() = default;
+    PopulationStore(const PopulationStore&) = delete;
+    PopulationStore& operator=(const PopulationStore&) = delete;
+
+    size_t size() const { return fitness.size(); }
+    bool empty() const { return fitness.empty(); }
+    void clear();
+    void resize(size_t count);
+
+    // agrega, lee o reemplaza un individuo completo
+    void push_back(const Chromosome& chromosome);
+    Chromosome get(size_t row) const;
+    void set(size_t row, const Chromosome& chromosome);
+    void copyRow(size_t row, const PopulationStore& from, size_t fromRow);
+
+    // filas ordenadas por fitness de mayor a menor, mismo orden que ordenar los cromosomas
+    void sortedRows(DynamicArray<int>& rows) const;
+
+    // las count filas de mayor fitness en orden, sin ordenar el resto, O(n + count log count)
+    // los empates se resuelven por numero de fila
+    void topRows(DynamicArray<int>& rows, size_t count) const;
+
+    // suma de |x_i - x_j| sobre todos los pares de filas de un gen, exacta y sin recorrer los pares
+    // ordena una copia de la columna en sorted por radix usando buffer, todo en O(n)
+    double pairwiseDistanceSum(Gene gene, DynamicArray<float>& sorted, DynamicArray<float>& buffer) const;
+
+    // fila con mayor fitness, la primera si hay empates
+    size_t bestRow() const;
+
+    // escribe los hijos del plan en las filas [first, first + plan.size()) a partir de la poblacion parents
+    // cruza y muta de a SIMD_LANES hijos por vez, retorna cuantos hijos cambiaron por mutacion
+    int breed(const PopulationStore& parents, const BreedingPlan& plan, size_t first);
+
+    const DynamicArray<float>& getGene(Gene gene) const { return genes[static_cast<int>(gene)]; }
+    const DynamicArray<float>& getFitness() const { return fitness; }
+    float getFitness(size_t row) const { return fitness[row]; }
+    void setFitness(size_t row, float value) { fitness[row] = value; }
+};
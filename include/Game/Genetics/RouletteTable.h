@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Systems/RandomService.h"
+
+// ruleta de seleccion armada una vez por generacion a partir del fitness de cada fila
+// cada fila pesa max(0.1, fitness) para que ningun individuo quede sin probabilidad
+// guarda las sumas acumuladas para giros en O(log n) y una tabla de alias para giros en O(1)
+class RouletteTable {
+private:
+    DynamicArray<float> cumulative;     // suma de los pesos hasta cada fila inclusive, en el orden de las filas
+    DynamicArray<float> keep;           // tabla de alias: probabilidad de quedarse con la columna sorteada
+    DynamicArray<int> alias;            // tabla de alias: fila que toma la columna cuando no se queda
+    DynamicArray<int> smallColumns;     // pilas de trabajo para armar la tabla, reutilizadas
+    DynamicArray<int> largeColumns;
+
+public:
+    static constexpr float MIN_WEIGHT = 0.1f;
+
+    // arma las sumas acumuladas y la tabla de alias, O(n)
+    void build(const DynamicArray<float>& fitness);
+
+    size_t size() const { return cumulative.size(); }
+    bool empty() const { return cumulative.empty(); }
+
+    // suma de todos los pesos, la misma que sumar los pesos fila por fila en orden
+    float total() const { return cumulative.empty() ? 0.0f : cumulative.back(); }
+
+    // primera fila cuya suma acumulada alcanza value, -1 si value supera el total
+    // da la misma fila que recorrer la poblacion acumulando fitness, con busqueda binaria
+    int spin(float value) const;
+
+    // fila sorteada en O(1) con la tabla de alias, misma distribucion que spin con otra secuencia
+    int drawAlias(RandomStream& random) const;
+
+    // muestreo universal estocastico: count punteros separados por total / count a partir de un solo giro
+    // agrega las filas en orden, cada fila aparece segun su peso con muy poca varianza
+    void universal(RandomStream& random, int count, DynamicArray<int>& rows) const;
+};
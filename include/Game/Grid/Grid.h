@@ -1,14 +1,28 @@
 #pragma once
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <vector>
+#include <cstdint>
+#include <utility>
+#include <memory>
 #include "../include/Game/Grid/Cell.h"
 #include "../include/DataStructures/DynamicArray.h"
 
+// torre registrada en la cuadricula junto con su celda
+struct PlacedTower {
+    int row;
+    int col;
+    Cell* cell;
+    std::shared_ptr<Tower> tower;
+
+    PlacedTower() : row(-1), col(-1), cell(nullptr) {}
+    PlacedTower(int row, int col, Cell* cell, std::shared_ptr<Tower> tower)
+        : row(row), col(col), cell(cell), tower(std::move(tower)) {}
+};
+
 class Grid {
 public:
     Grid(float x, float y, int rows, int cols, float cellSize);
-    void draw(sf::RenderWindow& window);
     Cell* getCellAtPosition(float x, float y);
     void clearSelection();
     Cell* getCellAt(int row, int col);
@@ -18,14 +32,29 @@ public:
     int getCols() const { return cols; }
     float getCellSize() const { return cellSize; }
     const DynamicArray<DynamicArray<Cell>>& getCells() const { return cells; }
-    bool loadBackgroundTextures();
-    sf::Texture groundTexture1;
-    sf::Texture groundTexture2;
-    bool texturesLoaded;
+
+    // coloca o quita (con nullptr) una torre y mantiene el mapa de celdas bloqueadas
+    void placeTower(int row, int col, std::shared_ptr<Tower> tower);
+    void placeTower(Cell* cell, std::shared_ptr<Tower> tower);
+    std::pair<int, int> getCellCoordinates(const Cell* cell) const;
+
+    // torres colocadas en orden de fila y columna, para no recorrer todas las celdas
+    const DynamicArray<PlacedTower>& getTowers() const { return towers; }
+
+    // consulta compacta de transitabilidad, fuera de la cuadricula cuenta como bloqueada
+    bool isWalkable(int row, int col) const {
+        if (row < 0 || row >= rows || col < 0 || col >= cols) return false;
+        size_t bit = static_cast<size_t>(row) * cols + col;
+        return (blockedBits[bit >> 6] & (uint64_t(1) << (bit & 63))) == 0;
+    }
 
 private:
+    void updateTowerRegistry(int row, int col, Cell* cell, const std::shared_ptr<Tower>& tower);
+
     DynamicArray<DynamicArray<Cell>> cells;
+    DynamicArray<uint64_t> blockedBits; // un bit por celda, 1 si tiene torre
+    DynamicArray<PlacedTower> towers;   // registro denso de torres, ordenado por celda
     float x, y;
     float cellSize;
     int rows, cols;
-};
\ No newline at end of file
+};
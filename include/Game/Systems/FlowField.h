@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include "../include/DataStructures/DynamicArray.h"
+
+class Grid;
+
+// mapa de distancias hacia el objetivo compartido por todos los enemigos
+// se calcula una vez con bfs desde el objetivo y luego se repara de forma incremental
+// cuando una sola celda cambia, cualquier enemigo obtiene su siguiente paso en o(1)
+class FlowField {
+private:
+    Grid* grid;
+    sf::Vector2f worldGoal;
+    int rows, cols;
+    int goalRow, goalCol;
+    int requestedGoalRow, requestedGoalCol;
+    DynamicArray<int> distances;
+    DynamicArray<int> queue;
+    DynamicArray<unsigned char> marks;
+    DynamicArray<int> touched;
+    DynamicArray<int> invalidated;
+
+    int index(int row, int col) const { return row * cols + col; }
+    bool isWalkable(int row, int col) const;
+    bool findStartCell(int& row, int& col) const;
+    int bestNeighborDistance(int row, int col) const;
+    void mark(int cell, unsigned char value);
+    void clearMarks();
+
+public:
+    static constexpr int UNREACHABLE = -1;
+
+    FlowField();
+
+    // recalcula las distancias de todas las celdas hacia el objetivo
+    void compute(Grid* grid, const sf::Vector2f& worldGoal);
+
+    // reparan solo la region afectada cuando una celda se bloquea o se libera
+    // deben llamarse despues de cambiar la torre de la celda en la cuadricula
+    void blockCell(int row, int col);
+    void unblockCell(int row, int col);
+
+    bool isValid() const { return grid != nullptr; }
+    int getDistance(int row, int col) const;
+    bool isReachable(const sf::Vector2f& worldPos) const;
+
+    // celda vecina que mas acerca al objetivo, falso si la celda no tiene camino
+    bool getNextCell(int row, int col, int& nextRow, int& nextCol) const;
+
+    // camino en coordenadas del mundo siguiendo el campo desde una posicion
+    DynamicArray<sf::Vector2f> extractPath(const sf::Vector2f& worldStart) const;
+    void extractPath(const sf::Vector2f& worldStart, DynamicArray<sf::Vector2f>& path) const;
+};
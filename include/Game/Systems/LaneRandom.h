@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../include/DataStructures/SimdLanes.h"
+#include "RandomService.h"
+
+// ocho generadores xoshiro128** independientes avanzando juntos, uno por carril
+// produce 8 numeros por llamada para los kernels que procesan varios individuos a la vez
+// cada carril sigue exactamente la misma recurrencia que RandomStream
+class LaneRandom {
+private:
+    UintLanes s0, s1, s2, s3;
+
+public:
+    LaneRandom();
+
+    // toma el estado de cada carril de un flujo, asi la secuencia depende de la semilla de la ejecucion
+    void seed(RandomStream& source);
+
+    // siguiente numero de 32 bits de cada carril
+    UintLanes next() {
+        // s1 * 5 y el resultado * 9 con desplazamientos, SSE2 no multiplica enteros de 32 bits
+        UintLanes scaled = shiftLeft<2>(s1) + s1;
+        UintLanes rotated = rotateLeft<7>(scaled);
+        UintLanes result = shiftLeft<3>(rotated) + rotated;
+        UintLanes t = shiftLeft<9>(s1);
+
+        s2 = s2 ^ s0;
+        s3 = s3 ^ s1;
+        s1 = s1 ^ s2;
+        s0 = s0 ^ s3;
+        s2 = s2 ^ t;
+        s3 = rotateLeft<11>(s3);
+
+        return result;
+    }
+
+    // real uniforme en [0, 1) por carril, mismo redondeo que RandomStream::nextFloat
+    FloatLanes nextUnit() {
+        return next().toUnitFloat();
+    }
+};
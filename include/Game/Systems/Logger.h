@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+// niveles del registro de menor a mayor severidad, Off solo sirve como nivel minimo
+enum class LogLevel : uint8_t {
+    Debug = 0,
+    Info = 1,
+    Warning = 2,
+    Error = 3,
+    Off = 4
+};
+
+// nivel minimo compilado, las llamadas por debajo desaparecen del binario junto con sus argumentos
+// por defecto las de debug solo se compilan sin NDEBUG, se puede fijar con -DGK_LOG_MIN_LEVEL=n
+#ifndef GK_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define GK_LOG_MIN_LEVEL 1
+#else
+#define GK_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+// argumento de un mensaje, se copia por valor y se formatea despues en el hilo de escritura
+// los textos deben ser literales o vivir hasta que el mensaje se escriba
+struct LogArg {
+    enum class Kind : uint8_t { Integer, Unsigned, Real, Boolean, Text };
+
+    Kind kind;
+    union {
+        int64_t integer;
+        uint64_t unsignedInteger;
+        double real;
+        bool boolean;
+        const char* text;
+    };
+
+    LogArg() : kind(Kind::Integer), integer(0) {}
+
+    template<typename T>
+    LogArg(T value) {
+        if constexpr (std::is_same<T, bool>::value) {
+            kind = Kind::Boolean;
+            boolean = value;
+        } else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+            kind = Kind::Integer;
+            integer = value;
+        } else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) {
+            kind = Kind::Unsigned;
+            unsignedInteger = static_cast<uint64_t>(value);
+        } else if constexpr (std::is_floating_point<T>::value) {
+            kind = Kind::Real;
+            real = value;
+        } else {
+            static_assert(std::is_convertible<T, const char*>::value, "LogArg solo guarda numeros, bool y textos");
+            kind = Kind::Text;
+            text = value;
+        }
+    }
+};
+
+// mensaje pendiente: formato con {} por cada argumento, sin salto de linea final
+struct LogRecord {
+    static const int MAX_ARGS = 6;
+
+    const char* format;
+    LogLevel level;
+    uint8_t argCount;
+    LogArg args[MAX_ARGS];
+};
+
+// registro asincrono: los hilos de simulacion solo copian el mensaje a un anillo sin bloqueos
+// y un hilo de fondo le da formato y lo escribe, asi la consola no frena los caminos calientes
+// si el anillo se llena el mensaje se descarta y se cuenta, nunca se espera al hilo de escritura
+class Logger {
+private:
+    static const size_t CAPACITY = 4096;    // potencia de dos, mensajes en vuelo como maximo
+
+    // casilla del anillo, sequence indica si esta libre para escribir o lista para leer
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    Slot slots[CAPACITY];
+    alignas(64) std::atomic<size_t> enqueuePosition;   // compartido por los productores
+    alignas(64) size_t dequeuePosition;                // solo se toca con writeMutex
+    std::atomic<uint8_t> minimumLevel;
+    std::atomic<size_t> dropped;
+    size_t reportedDrops;                               // descartes ya avisados, solo con writeMutex
+    std::atomic<bool> stopping;
+    std::mutex writeMutex;                              // un solo consumidor a la vez
+    std::ostream* output;
+    std::thread writer;
+
+    Logger();
+    ~Logger();
+
+    bool push(LogLevel level, const char* format, const LogArg* args, size_t argCount);
+    size_t drain();
+    void write(const LogRecord& record);
+    void writerLoop();
+
+public:
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // registro global, el hilo de escritura arranca con el primer uso
+    static Logger& instance();
+
+    // encola un mensaje si el nivel esta activo, cuesta una reserva atomica y una copia
+    template<typename... Args>
+    void log(LogLevel level, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= LogRecord::MAX_ARGS, "demasiados argumentos para un mensaje");
+        if (!isEnabled(level)) return;
+
+        const LogArg packed[sizeof...(Args) + 1] = {LogArg(args)...};
+        push(level, format, packed, sizeof...(Args));
+    }
+
+    bool isEnabled(LogLevel level) const {
+        return static_cast<uint8_t>(level) >= minimumLevel.load(std::memory_order_relaxed);
+    }
+
+    // nivel minimo en tiempo de ejecucion, Off descarta todo sin encolar
+    void setLevel(LogLevel level);
+    LogLevel getLevel() const;
+
+    // cambia el destino, escribe antes lo pendiente en el destino anterior
+    void setOutput(std::ostream& stream);
+
+    // escribe todo lo encolado hasta ahora antes de volver
+    void flush();
+
+    // mensajes perdidos desde el inicio porque el anillo estaba lleno
+    size_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+// macros de registro, las de niveles bajo GK_LOG_MIN_LEVEL no evaluan sus argumentos
+#if GK_LOG_MIN_LEVEL <= 0
+#define GK_LOG_DEBUG(...) Logger::instance().log(LogLevel::Debug, __VA_ARGS__)
+#else
+#define GK_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if GK_LOG_MIN_LEVEL <= 1
+#define GK_LOG_INFO(...) Logger::instance().log(LogLevel::Info, __VA_ARGS__)
+#else
+#define GK_LOG_INFO(...) ((void)0)
+#endif
+
+#if GK_LOG_MIN_LEVEL <= 2
+#define GK_LOG_WARNING(...) Logger::instance().log(LogLevel::Warning, __VA_ARGS__)
+#else
+#define GK_LOG_WARNING(...) ((void)0)
+#endif
+
+#if GK_LOG_MIN_LEVEL <= 3
+#define GK_LOG_ERROR(...) Logger::instance().log(LogLevel::Error, __VA_ARGS__)
+#else
+#define GK_LOG_ERROR(...) ((void)0)
+#endif
@@ -1,47 +1,17 @@
 #pragma once
 
 #include <SFML/System/Vector2.hpp>
-#include <vector>
 #include "../include/DataStructures/DynamicArray.h"
-#include <queue>
-#include <unordered_set>
-#include <memory>
+#include <utility>
 
 class Grid;
 
 class Pathfinding {
 private:
-    struct Node {
-        int row, col;
-        float g;
-        float h;
-        float f;
-        std::shared_ptr<Node> parent;
-
-        Node(int r, int c) : row(r), col(c), g(0), h(0), f(0), parent(nullptr) {}
-
-        bool operator==(const Node& other) const {
-            return row == other.row && col == other.col;
-        }
-    };
-
-    struct NodeHash {
-        std::size_t operator()(const Node& node) const {
-            return std::hash<int>()(node.row) ^ (std::hash<int>()(node.col) << 1);
-        }
-    };
-
-    struct NodeCompare {
-        bool operator()(const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) const {
-            return a->f > b->f;
-        }
-    };
-
-    static float calculateHeuristic(int r1, int c1, int r2, int c2);
-    static DynamicArray<std::pair<int, int>> getNeighbors(int row, int col, Grid* grid);
-    static DynamicArray<sf::Vector2f> reconstructPath(std::shared_ptr<Node> endNode, Grid* grid);
-    static bool isValidCell(int row, int col, Grid* grid);
+    static int calculateHeuristic(int r1, int c1, int r2, int c2);
+    static DynamicArray<sf::Vector2f> reconstructPath(const int* parents, int endIndex, int cols, Grid* grid);
     static bool isCellWalkable(int row, int col, Grid* grid);
+    static int search(Grid* grid, const sf::Vector2f& worldStart, const sf::Vector2f& worldGoal);
 
 public:
     static DynamicArray<sf::Vector2f> findPath(
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Systems/TowerLayout.h"
+#include "../include/Game/Systems/ThreadPool.h"
+#include "../include/Game/Systems/WaveManager.h"
+#include "../include/Game/Genetics/Genetics.h"
+
+// parametros de cada oleada aislada usada para evaluar un cromosoma
+struct TrialConfig {
+    int rows = 11;
+    int cols = 20;
+    float cellSize = 70.0f;
+    float timestep = 1.0f / 60.0f;
+    float maxTrialTime = 300.0f;
+};
+
+// evalua cada cromosoma de la poblacion en su propia simulacion sin interfaz
+// las simulaciones son independientes, asi que se reparten entre todos los nucleos
+class PopulationEvaluator {
+private:
+    DynamicArray<TowerPlacement> layout;
+    TrialConfig config;
+    ThreadPool pool;
+    float pathLength;
+
+    EnemyPerformance runTrial(const Chromosome& chromosome, int waveNumber, uint64_t seed) const;
+
+public:
+    PopulationEvaluator(const DynamicArray<TowerPlacement>& placements, const TrialConfig& config, int threadCount = 0);
+
+    // simula toda la poblacion y asigna el fitness de cada cromosoma antes de crear la siguiente generacion
+    DynamicArray<EnemyPerformance> evaluate(Genetics& genetics, int waveNumber, uint64_t seed);
+
+    int getThreadCount() const { return pool.getThreadCount(); }
+    int getTowerCount() const { return static_cast<int>(layout.size()); }
+    float getPathLength() const { return pathLength; }
+};
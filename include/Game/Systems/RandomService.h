@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+// subsistemas que consumen numeros aleatorios, cada uno con su propio flujo
+enum class RandomSubsystem {
+    Genetics,
+    Chromosomes,
+    Waves,
+    Towers,
+    Visual,
+    Breeding,       // generadores por carriles del cruzamiento en lote
+    Count
+};
+
+
+
+// generador xoshiro128** rapido y de estado pequeño
+// cumple con UniformRandomBitGenerator para usarse con las distribuciones de <random>
+class RandomStream {
+private:
+    uint32_t state[4];
+
+public:
+    using result_type = uint32_t;
+
+    RandomStream();
+    explicit RandomStream(uint64_t seed);
+
+    void seed(uint64_t seed);
+    uint32_t operator()();
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint32_t>::max(); }
+
+    // numero real uniforme en [0, 1)
+    float nextFloat();
+
+    // numero real uniforme en [minValue, maxValue)
+    float range(float minValue, float maxValue);
+
+    // entero uniforme en [minValue, maxValue]
+    int rangeInt(int minValue, int maxValue);
+};
+
+
+
+// servicio central de aleatoriedad con una unica semilla por ejecucion
+// cada subsistema obtiene un flujo independiente derivado de esa semilla
+class RandomService {
+private:
+    uint64_t runSeed;
+    RandomStream streams[static_cast<int>(RandomSubsystem::Count)];
+
+public:
+    static constexpr uint64_t DEFAULT_SEED = 0x5EEDC0DEULL;
+
+    explicit RandomService(uint64_t seed = DEFAULT_SEED);
+
+    void reseed(uint64_t seed);
+    uint64_t getSeed() const { return runSeed; }
+    RandomStream& stream(RandomSubsystem subsystem);
+
+    // semilla basada en el reloj del sistema para partidas no reproducibles
+    static uint64_t timeSeed();
+
+    // deriva una semilla independiente a partir de otra y un valor distintivo
+    static uint64_t mixSeed(uint64_t seed, uint64_t salt);
+};
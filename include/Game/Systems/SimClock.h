@@ -0,0 +1,46 @@
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+// reloj de tiempo simulado, solo avanza cuando la simulacion da un paso
+// permite correr la simulacion mas rapido que el tiempo real con resultados identicos
+class SimClock {
+private:
+    double now = 0.0;
+
+public:
+    void advance(float dt) { now += dt; }
+    void reset() { now = 0.0; }
+    double getTime() const { return now; }
+};
+
+
+
+// temporizador con la misma interfaz que sf::Clock pero medido en tiempo simulado
+// sin reloj asignado no avanza, por lo que el tiempo transcurrido siempre es cero
+class SimTimer {
+private:
+    const SimClock* clock = nullptr;
+    double start = 0.0;
+
+public:
+    SimTimer() = default;
+    explicit SimTimer(const SimClock* clock) : clock(clock), start(clock ? clock->getTime() : 0.0) {}
+
+    // asigna el reloj de referencia y reinicia la medicion
+    void setClock(const SimClock* newClock) {
+        clock = newClock;
+        restart();
+    }
+
+    sf::Time getElapsedTime() const {
+        if (!clock) return sf::Time::Zero;
+        return sf::seconds(static_cast<float>(clock->getTime() - start));
+    }
+
+    sf::Time restart() {
+        sf::Time elapsed = getElapsedTime();
+        start = clock ? clock->getTime() : 0.0;
+        return elapsed;
+    }
+};
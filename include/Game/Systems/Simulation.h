@@ -0,0 +1,116 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/DataStructures/LinearArena.h"
+#include "../include/Game/Grid/Grid.h"
+#include "../include/Game/Systems/WaveManager.h"
+#include "../include/Game/Systems/SimulationEvent.h"
+#include "../include/Game/Systems/SimClock.h"
+#include "../include/Game/Systems/RandomService.h"
+#include "../include/Game/Systems/FlowField.h"
+#include "../include/Game/Systems/SpatialHash.h"
+#include "../include/Game/Genetics/Genetics.h"
+#include "../include/Game/Enemies/Enemy.h"
+#include "../include/Game/Enemies/EnemyPool.h"
+
+// resumen de una generacion evaluada, usado por estadisticas y corridas por lotes
+struct GenerationStats {
+    int generation;
+    int wave;
+    int enemies;
+    int reachedEnd;
+    float averageFitness;
+    float bestFitness;
+    float diversity;
+    float mutationRate;
+    int mutationCount;
+    int peakEnemies;        // maximo de enemigos simultaneos en la oleada, el tamano que alcanzo el pool
+
+    GenerationStats()
+        : generation(0), wave(0), enemies(0), reachedEnd(0), averageFitness(0.0f),
+          bestFitness(0.0f), diversity(0.0f), mutationRate(0.0f), mutationCount(0), peakEnemies(0) {}
+};
+
+// nucleo de la simulacion del juego, sin dependencias graficas
+// contiene la cuadricula, las oleadas, el algoritmo genetico, enemigos y torres
+class Simulation {
+private:
+    std::unique_ptr<Grid> grid;
+    EnemyStore enemyStore;                      // estado caliente de los enemigos, mismo orden que enemies
+    EnemyPool enemyPool;                        // enemigos muertos listos para reutilizarse
+    DynamicArray<std::unique_ptr<Enemy>> enemies;
+    DynamicArray<std::unique_ptr<Enemy>> spawnedEnemies; // enemigos nuevos de cada paso, reutilizado
+    std::unique_ptr<WaveManager> waveManager;
+    std::unique_ptr<Genetics> genetics;
+    sf::Vector2f spawnPoint;
+    sf::Vector2f goalPoint;
+    SimulationEventQueue events;
+    SimClock clock;
+    RandomService random;
+    FlowField flowField;
+    SpatialHash enemyIndex;                     // enemigos por cubeta, reconstruido en cada paso
+    DynamicArray<int> targetCandidates;         // resultado reutilizado de las consultas por rango
+    LinearArena frameArena;                     // temporales de un paso, se limpia al final de cada step
+    bool recordEvents;
+    bool autoAdvanceGenerations;
+    int enemiesKilled;
+    int enemiesReachedEnd;
+    float pathLength;
+    GenerationStats lastGenerationStats;
+
+public:
+    Simulation(float gridX, float gridY, int rows, int cols, float cellSize,
+               int populationSize = 20, float mutationRate = 0.25f, float crossoverRate = 0.85f,
+               float enemySpawnInterval = 1.5f, uint64_t seed = RandomService::DEFAULT_SEED);
+
+    void start();
+    void step(float dt);
+    void runFor(float seconds, float timestep);
+    bool runUntilWaveEnds(float timestep, float maxSeconds);
+    bool isWaveFinished() const;
+    bool canPlaceTowerAt(Cell* cell);
+    bool placeTower(Cell* cell, std::shared_ptr<Tower> tower);
+    void prepareNextGeneration();
+    void startTrial(const Chromosome& chromosome, int waveNumber);
+    void collectEnemyPerformanceData();
+
+    Grid& getGrid() { return *grid; }
+    const Grid& getGrid() const { return *grid; }
+    WaveManager& getWaveManager() { return *waveManager; }
+    const WaveManager& getWaveManager() const { return *waveManager; }
+    Genetics& getGenetics() { return *genetics; }
+    const Genetics& getGenetics() const { return *genetics; }
+    const DynamicArray<std::unique_ptr<Enemy>>& getEnemies() const { return enemies; }
+    sf::Vector2f getSpawnPoint() const { return spawnPoint; }
+    sf::Vector2f getGoalPoint() const { return goalPoint; }
+    float getPathLength() const { return pathLength; }
+    const FlowField& getFlowField() const { return flowField; }
+    double getTime() const { return clock.getTime(); }
+    const SimClock& getClock() const { return clock; }
+    uint64_t getSeed() const { return random.getSeed(); }
+    int getEnemiesKilled() const { return enemiesKilled; }
+    int getEnemiesReachedEnd() const { return enemiesReachedEnd; }
+    const EnemyPool& getEnemyPool() const { return enemyPool; }
+    const GenerationStats& getLastGenerationStats() const { return lastGenerationStats; }
+    const LinearArena& getFrameArena() const { return frameArena; }
+
+    // eventos generados desde la ultima llamada a clearEvents
+    const SimulationEventQueue& getEvents() const { return events; }
+    void clearEvents() { events.clear(); }
+    void setRecordEvents(bool record) { recordEvents = record; }
+    void setAutoAdvanceGenerations(bool autoAdvance) { autoAdvanceGenerations = autoAdvance; }
+
+private:
+    void initializeSpawnAndGoalPoints();
+    void recalculateEnemyPaths(const sf::Vector2f& changedCell);
+    void updateEnemyStates(float dt);
+    void removeEnemy(size_t index);
+    void handleTowerAttacks(float dt);
+    void advanceGeneration();
+    void processEnemyDeath(Enemy& enemy);
+    void processEnemyReachedEnd(Enemy& enemy);
+    void pushEnemyEvent(SimulationEventType type, const Enemy& enemy, float amount);
+    SimulationEventQueue* eventQueue() { return recordEvents ? &events : nullptr; }
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include "../include/DataStructures/DynamicArray.h"
+
+class Tower;
+
+// tipos de eventos que la simulacion reporta a la capa visual
+enum class SimulationEventType {
+    EnemyDamaged,
+    EnemyKilled,
+    EnemyReachedEnd,
+    TowerFired,
+    TowerUpgraded
+};
+
+// evento generado por la simulacion durante un paso de actualizacion
+struct SimulationEvent {
+    SimulationEventType type;
+    int enemyId;              // enemigo involucrado (-1 si no aplica)
+    const Tower* tower;       // torre involucrada (nullptr si no aplica)
+    sf::Vector2f position;    // posicion del enemigo o del origen del disparo
+    sf::Vector2f target;      // destino del proyectil
+    float amount;             // daño aplicado u oro otorgado segun el tipo
+    float fitness;            // fitness estimado del enemigo al terminar
+    bool special;             // indica si fue un ataque especial
+
+    SimulationEvent()
+        : type(SimulationEventType::EnemyDamaged), enemyId(-1), tower(nullptr),
+          amount(0.0f), fitness(0.0f), special(false) {}
+};
+
+// cola de eventos compartida entre la simulacion, torres y enemigos
+using SimulationEventQueue = DynamicArray<SimulationEvent>;
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include "../include/DataStructures/DynamicArray.h"
+
+// indice espacial uniforme: divide el mapa en cubetas del tamano de una celda
+// se reconstruye cada paso desde las posiciones de los enemigos y responde consultas
+// por radio revisando solo las cubetas que toca el circulo
+class SpatialHash {
+private:
+    float originX, originY;
+    float bucketSize;
+    int bucketCols, bucketRows;
+    DynamicArray<int> bucketStart;      // inicio de cada cubeta en entries (bucketCount + 1 valores)
+    DynamicArray<int> entries;          // indices de elementos ordenados por cubeta
+    DynamicArray<int> entryBucket;      // cubeta de cada elemento durante la reconstruccion
+    DynamicArray<sf::Vector2f> positions;
+
+    int bucketColumn(float worldX) const;
+    int bucketRow(float worldY) const;
+
+public:
+    SpatialHash();
+
+    // define el area cubierta, las posiciones fuera de ella caen en las cubetas del borde
+    void configure(float x, float y, float width, float height, float bucketSize);
+
+    // reconstruye las cubetas en o(n) con un conteo por cubeta
+    void rebuild(const DynamicArray<sf::Vector2f>& itemPositions);
+
+    // indices de los elementos dentro del radio, en orden ascendente
+    void queryRange(const sf::Vector2f& center, float radius, DynamicArray<int>& result) const;
+
+    size_t size() const { return positions.size(); }
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "../include/DataStructures/DynamicArray.h"
+
+// grupo de hilos persistentes para repartir trabajos independientes por indice
+// los hilos se crean una sola vez y esperan entre lotes
+class ThreadPool {
+private:
+    DynamicArray<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+    std::function<void(size_t)> task;
+    size_t taskCount;
+    std::atomic<size_t> nextIndex;
+    int activeWorkers;
+    unsigned long batchId;
+    bool stopping;
+
+    void workerLoop();
+
+public:
+    // con cero hilos se usan todos los nucleos disponibles
+    explicit ThreadPool(int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // ejecuta fn(i) para cada i en [0, count) y espera a que todos terminen
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+};
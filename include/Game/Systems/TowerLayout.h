@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Towers/Tower.h"
+
+class Simulation;
+
+// torre a colocar en una celda de la cuadricula
+struct TowerPlacement {
+    int row;
+    int col;
+    std::string type;
+    int level;
+
+    TowerPlacement() : row(0), col(0), level(1) {}
+};
+
+// carga y aplica distribuciones de torres para simulaciones sin interfaz
+// formato del archivo: una torre por linea "fila columna tipo [nivel]", '#' inicia comentario
+class TowerLayout {
+public:
+    static bool loadFromFile(const std::string& filename, DynamicArray<TowerPlacement>& placements);
+    static std::shared_ptr<Tower> createTower(const std::string& type);
+    static int apply(Simulation& simulation, const DynamicArray<TowerPlacement>& placements);
+};
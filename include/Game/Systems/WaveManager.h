@@ -1,11 +1,16 @@
 #pragma once
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <unordered_map>
 #include "../include/DataStructures/DynamicArray.h"
+#include "../include/DataStructures/FreeListResource.h"
 #include "../include/Game/Enemies/Enemy.h"
+#include "../include/Game/Enemies/EnemyPool.h"
 #include "../include/Game/Grid/Grid.h"
 #include "../include/Game/Genetics/Chromosome.h"
+#include "../include/Game/Systems/SimClock.h"
+#include "../include/Game/Systems/RandomService.h"
+#include "../include/Game/Systems/FlowField.h"
 #include <memory>
 
 struct EnemyPerformance {
@@ -33,20 +38,29 @@ private:
     int enemiesSpawned;
     int enemiesRemaining;
     int enemiesPerWave;
-    sf::Clock enemySpawnTimer;
+    SimTimer enemySpawnTimer;
     DynamicArray<Chromosome> currentWaveChromosomes;
-    std::unordered_map<int, EnemyPerformance> enemyPerformanceData;
+    FreeListResource performanceNodes;      // nodos del mapa de rendimiento, reciclados entre oleadas
+    std::unordered_map<int, EnemyPerformance, std::hash<int>, std::equal_to<int>,
+                       ResourceAllocator<std::pair<const int, EnemyPerformance>>> enemyPerformanceData;
     float pathTotalLength;
     float lastWaveMaxProgress;
     float lastWaveAvgProgress;
     float lastWaveAvgDamage;
     float lastWaveEffectiveness;
     int lastWaveReachedCount;
+    const SimClock* clock;
+    RandomStream* random;
+    const FlowField* flowField;
+    EnemyPool* enemyPool;
+    MemoryResource* scratch;                // memoria para temporales internos, nullptr usa el heap
+    DynamicArray<sf::Vector2f> spawnPath;   // ruta de aparicion reutilizada entre enemigos
 
 public:
     WaveManager(const DynamicArray<sf::Vector2f>& path, Grid* grid, const sf::Vector2f& goal, float enemySpawnInterval = 1.5f);
-    DynamicArray<std::unique_ptr<Enemy>> update(float dt);
+    void update(float dt, DynamicArray<std::unique_ptr<Enemy>>& newEnemies);
     void startNextWave();
+    void startWave(int waveNumber, int enemyCount);
     void setWaveChromosomes(const DynamicArray<Chromosome>& chromosomes);
     void trackEnemyPerformance(int enemyId, bool reachedEnd, float distanceTraveled, float damageReceived, float timeAlive);
     void trackEnemyDeath(int enemyId, const Enemy& enemy);
@@ -57,16 +71,21 @@ public:
     int getEnemiesPerWave() const { return enemiesPerWave; }
     bool isWaveInProgress() const;
     bool isWaveComplete() const;
-    DynamicArray<bool> getEnemiesReachedEnd() const;
-    DynamicArray<float> getDistancesTraveled() const;
-    DynamicArray<float> getDamagesReceived() const;
-    DynamicArray<float> getTimesAlive() const;
-    DynamicArray<float> getDamageEffectiveness() const;
+    DynamicArray<bool> getEnemiesReachedEnd(MemoryResource* resource = nullptr) const;
+    DynamicArray<float> getDistancesTraveled(MemoryResource* resource = nullptr) const;
+    DynamicArray<float> getDamagesReceived(MemoryResource* resource = nullptr) const;
+    DynamicArray<float> getTimesAlive(MemoryResource* resource = nullptr) const;
+    DynamicArray<float> getDamageEffectiveness(MemoryResource* resource = nullptr) const;
     float getLastWaveAverageDamage() const { return lastWaveAvgDamage; }
     float getLastWaveEffectiveness() const { return lastWaveEffectiveness; }
     int getLastWaveReachedCount() const { return lastWaveReachedCount; }
     float getWaveDifficulty() const;
     void setPathTotalLength(float length);
+    void setClock(const SimClock* simClock);
+    void setRandomStream(RandomStream* stream);
+    void setFlowField(const FlowField* field);
+    void setEnemyPool(EnemyPool* pool);
+    void setScratchMemory(MemoryResource* resource);
     void reset();
 
 private:
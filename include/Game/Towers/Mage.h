@@ -7,22 +7,20 @@
 #define MAGE_H
 
 #include "Tower.h"
+#include "Game/Enemies/Enemy.h"
 #include <iostream>
-#include "Effects/Fireball.h"
 #include <vector>
 
 class Mage : public Tower {
+private:
+    DynamicArray<int> nearbyEnemies; // resultado reutilizado de la consulta del area
+    DynamicArray<DamageHit> areaHits; // impactos del area acumulados antes de aplicarlos
+
 public:
     Mage();
     void attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>& allEnemies) override;
-    std::string type() const override { return "Mage"; }
     int getUpgradeCost() const override;
     void upgrade() override;
-    void updateProjectiles(float dt);
-    void drawProjectiles(sf::RenderWindow& window);
-private:
-    std::vector<Fireball> activeFireballs;
-    sf::Texture fireballTexture;
 };
 
 #endif // MAGE_H
@@ -1,42 +1,58 @@
 #ifndef TOWER_H
 #define TOWER_H
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <string>
 #include <memory>
 #include "./DataStructures/DynamicArray.h"
+#include "Game/Systems/SimulationEvent.h"
+#include "Game/Systems/SimClock.h"
+#include "Game/Systems/RandomService.h"
+#include "Game/Systems/SpatialHash.h"
 
 class Enemy; // Forward declaration
-class AudioSystem; // Forward para evitar incluir directamente
+
+// etiqueta del tipo concreto, evita comparar cadenas y usar rtti en cada cuadro
+enum class TowerType {
+    Archer,
+    Mage,
+    Gunner
+};
+
+const char* towerTypeName(TowerType type);
 
 class Tower {
 protected:
+    const TowerType towerType;
     int cost;
     int damage;
     float range;
     float attackSpeed;
     float specialCooldown;
-    sf::Sprite sprite;
-    sf::Texture texture;
-    sf::Clock attackClock;
-    sf::Clock specialClock;
+    sf::Vector2f position;
+    SimTimer attackClock;
+    SimTimer specialClock;
     float specialChance = 0.8f;
     int level = 1;
     const int maxLevel = 3;
+    SimulationEventQueue* events = nullptr;
+    RandomStream* random = nullptr;
+    const SpatialHash* enemyIndex = nullptr; // indice de enemigos para ataques en area
 
-    inline static sf::Font sharedFont;
-    inline static AudioSystem* audioSystem = nullptr;
+    void notifyShot(const Enemy& enemy, bool special);
+    void notifyUpgrade();
+    float rollSpecial();
 
 public:
-    Tower(int cost, int damage, float range, float attackSpeed, float specialCooldown);
+    Tower(TowerType towerType, int cost, int damage, float range, float attackSpeed, float specialCooldown);
 
     virtual ~Tower() = default;
 
     virtual void attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>& allEnemies) = 0;
-    virtual std::string type() const = 0;
+    TowerType getType() const { return towerType; }
 
     virtual void setPosition(const sf::Vector2f& pos);
-    virtual const sf::Sprite& getSprite() const;
+    sf::Vector2f getPosition() const;
 
     float getRange() const;
     int getCost() const;
@@ -46,13 +62,10 @@ public:
     virtual int getUpgradeCost() const = 0;
     virtual void upgrade() = 0;
 
-    sf::Clock upgradeFlashClock;
-    bool recentlyUpgraded = false;
-
-    static void setSharedFont(const sf::Font& font);
-    const sf::Font& getFont() const;
-
-    static void setAudioSystem(AudioSystem* audio);
+    void setEventQueue(SimulationEventQueue* queue);
+    virtual void setClock(const SimClock* clock);
+    void setRandomStream(RandomStream* stream);
+    void setEnemyIndex(const SpatialHash* index);
 };
 
 #endif // TOWER_H
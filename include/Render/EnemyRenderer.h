@@ -0,0 +1,44 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include "../include/DataStructures/DynamicArray.h"
+#include "../include/Game/Enemies/Enemy.h"
+#include "../include/Game/Systems/SimulationEvent.h"
+#include "../include/Game/Systems/RandomService.h"
+#include "../include/Core/TextureCache.h"
+
+struct FloatingDamageText {
+    sf::Text text;
+    sf::Clock timer;
+
+    FloatingDamageText() {
+        timer.restart();
+    }
+};
+
+// dibuja los enemigos de la simulacion, sus barras de vida y el daño recibido
+class EnemyRenderer {
+public:
+    EnemyRenderer();
+    bool loadTextures(TextureCache& textures);
+    void setFont(const sf::Font& font);
+    void handleEvent(const SimulationEvent& event);
+    void update(float dt);
+    void draw(sf::RenderWindow& window, const DynamicArray<std::unique_ptr<Enemy>>& enemies);
+
+private:
+    const sf::Texture* ogreTexture = nullptr;
+    const sf::Texture* darkElfTexture = nullptr;
+    const sf::Texture* harpyTexture = nullptr;
+    const sf::Texture* mercenaryTexture = nullptr;
+    sf::Sprite sprite;
+    sf::RectangleShape healthBar;
+    sf::RectangleShape healthBarBorder;
+    DynamicArray<FloatingDamageText> floatingTexts;
+    const sf::Font* font;
+    RandomStream random;
+
+    void createDamageText(const sf::Vector2f& position, float damage);
+    void drawEnemy(sf::RenderWindow& window, const Enemy& enemy);
+};
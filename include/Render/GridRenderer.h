@@ -0,0 +1,32 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include "../include/Game/Grid/Grid.h"
+#include "../include/Game/Systems/SimulationEvent.h"
+#include "../include/Core/TextureCache.h"
+
+// dibuja la cuadricula de la simulacion y las torres colocadas
+class GridRenderer {
+public:
+    GridRenderer();
+    bool loadTextures(TextureCache& textures);
+    void handleEvent(const SimulationEvent& event);
+    void draw(sf::RenderWindow& window, const Grid& grid, const sf::Font& font);
+
+private:
+    const sf::Texture* groundTexture1;
+    const sf::Texture* groundTexture2;
+    const sf::Texture* archerTexture;
+    const sf::Texture* mageTexture;
+    const sf::Texture* gunnerTexture;
+    bool texturesLoaded;
+    sf::RectangleShape backgroundShape;
+    sf::RectangleShape borderShape;
+    sf::Sprite towerSprite;
+    std::unordered_map<const Tower*, sf::Clock> upgradeFlashes;
+
+    void drawCell(sf::RenderWindow& window, const Cell& cell, bool useTexture1);
+    void drawTower(sf::RenderWindow& window, const Cell& cell, const sf::Font& font);
+    const sf::Texture& getTowerTexture(const Tower& tower) const;
+};
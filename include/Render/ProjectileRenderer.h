@@ -0,0 +1,26 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "../include/Game/Systems/SimulationEvent.h"
+#include "../include/Core/TextureCache.h"
+#include "Effects/Arrow.h"
+#include "Effects/Fireball.h"
+#include "Effects/Cannonball.h"
+
+// anima los proyectiles de las torres a partir de los disparos de la simulacion
+class ProjectileRenderer {
+public:
+    bool loadTextures(TextureCache& textures);
+    void handleEvent(const SimulationEvent& event);
+    void update(float dt);
+    void draw(sf::RenderWindow& window);
+
+private:
+    const sf::Texture* arrowTexture = nullptr;
+    const sf::Texture* fireballTexture = nullptr;
+    const sf::Texture* cannonballTexture = nullptr;
+    std::vector<Arrow> activeArrows;
+    std::vector<Fireball> activeFireballs;
+    std::vector<Cannonball> activeBullets;
+};
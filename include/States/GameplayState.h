@@ -3,30 +3,23 @@
 #include <SFML/Graphics.hpp>
 #include "GameState.h"
 #include <memory>
-#include "../include/Game/Grid/Grid.h"
-#include "../include/Game/Systems/WaveManager.h"
-#include "../include/Game/Genetics/Genetics.h"
-#include "../include/Game/Enemies/Enemy.h"
+#include "../include/Game/Systems/Simulation.h"
+#include "../include/Render/GridRenderer.h"
+#include "../include/Render/EnemyRenderer.h"
+#include "../include/Render/ProjectileRenderer.h"
 #include "../include/UI/Button.h"
 #include "../include/UI/StatsPanel.h"
 
-enum class TowerType {
-    Archer,
-    Mage,
-    Gunner
-};
-
 class GameplayState : public GameState {
 private:
-    std::unique_ptr<Grid> gameGrid;
+    std::unique_ptr<Simulation> simulation;
+    Grid* gameGrid = nullptr;
     const int GRID_ROWS = 11;
     const int GRID_COLS = 20;
     const float CELL_SIZE = 70.0f;
-    DynamicArray<std::unique_ptr<Enemy>> enemies;
-    std::unique_ptr<WaveManager> waveManager;
-    std::unique_ptr<Genetics> geneticsSystem;
-    sf::Vector2f spawnPoint;
-    sf::Vector2f goalPoint;
+    GridRenderer gridRenderer;
+    EnemyRenderer enemyRenderer;
+    ProjectileRenderer projectileRenderer;
     int playerGold = 200;
     int enemiesKilled;
     bool gameOver;
@@ -44,7 +37,6 @@ private:
     sf::Clock goldWarningClock;
     sf::Clock pathBlockedClock;
     sf::RectangleShape greenBackground;
-    sf::Texture backgroundTexture;
     sf::Sprite backgroundSprite;
     bool backgroundLoaded = false;
     std::unique_ptr<StatsPanel> statsPanel;
@@ -68,16 +60,12 @@ private:
     void loadGameplaySounds();
     void startGameplayMusic();
     bool loadBackgroundTexture();
-    void initializeSpawnAndGoalPoints();
     void stopMusic();
-    bool canPlaceTowerAt(class Cell* cell);
-    void recalculateEnemyPaths();
-    void handleTowerAttacks(float dt);
+    void placeTower(std::shared_ptr<Tower> tower);
     void prepareNextGeneration();
     void updateStatsPanel();
-    void collectEnemyPerformanceData();
     bool clickedOutsideButtonsAndSelectedCell(const sf::Vector2f& mousePos) const;
-    void processEnemyDeath(std::unique_ptr<Enemy>& enemy);
-    void processEnemyReachedEnd(std::unique_ptr<Enemy>& enemy);
-    void updateEnemyStates(float dt);
+    void handleSimulationEvents();
+    void processEnemyDeath(const SimulationEvent& event);
+    void processEnemyReachedEnd(const SimulationEvent& event);
 };
\ No newline at end of file
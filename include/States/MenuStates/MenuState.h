@@ -12,9 +12,7 @@
 
 class MenuState : public GameState {
 private:
-    sf::Texture backgroundTexture;
     sf::Sprite backgroundSprite;
-    sf::Texture logoTexture;
     sf::Sprite logoSprite;
     std::unique_ptr<ParticleSystem> particleSystem;
     std::vector<std::unique_ptr<Button>> buttons;
@@ -9,7 +9,6 @@
 
 class SettingsState : public GameState {
 private:
-    sf::Texture backgroundTexture;
     sf::Sprite backgroundSprite;
     std::vector<std::unique_ptr<Button>> buttons;
     std::unique_ptr<Slider> masterVolumeSlider;
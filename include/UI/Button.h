@@ -4,14 +4,15 @@
 #include <SFML/Graphics.hpp>
 #include <functional>
 #include <string>
+#include "../include/Core/TextureCache.h"
 
 class Button {
 private:
     sf::RectangleShape shape;
     sf::Text text;
     std::function<void()> callback;
-    sf::Texture buttonTexture;
-    sf::Texture buttonSelectedTexture;
+    const sf::Texture* buttonTexture = nullptr;
+    const sf::Texture* buttonSelectedTexture = nullptr;
 
     bool useTexture;
     bool isSelected;
@@ -27,7 +28,7 @@ public:
     void activate();
     void draw(sf::RenderWindow& window);
     void setText(const std::string& text);
-    void setTextures(const std::string& normalTexture, const std::string& selectedTexture);
+    void setTextures(TextureCache& textures, const std::string& normalTexture, const std::string& selectedTexture);
     void setCallback(std::function<void()> callback);
     bool handleEvent(const sf::Event& event);
     sf::FloatRect getBounds() const;
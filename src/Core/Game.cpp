@@ -1,11 +1,12 @@
 #include "../include/Core/Game.h"
 #include "../include/States/MenuStates/MenuState.h"
 #include <iostream>
+#include <algorithm>
 
 
 
 // constructor de la clase game, inicializa la variable running en falso
-Game::Game() : running(false) {
+Game::Game() : running(false), accumulator(0.0f) {
 }
 
 
@@ -46,7 +47,9 @@ void Game::run() {
     // mientras el juego este corriendo, la ventana abierta y haya estados en la pila
     while (running && window.isOpen() && !states.empty()) {
         frameTime = clock.restart();
-        float dt = frameTime.asSeconds();
+
+        // acumular tiempo real, limitado para no encadenar demasiados pasos tras una pausa
+        accumulator += std::min(frameTime.asSeconds(), MAX_FRAME_TIME);
 
         sf::Event event;
         // procesa todos los eventos de la ventana
@@ -60,9 +63,12 @@ void Game::run() {
                 states.top()->handleEvents(event);
         }
 
-        // actualiza el estado actual
-        if (!states.empty())
-            states.top()->update(dt);
+        // actualiza el estado actual en pasos fijos para resultados deterministas
+        while (accumulator >= FIXED_TIMESTEP) {
+            if (!states.empty())
+                states.top()->update(FIXED_TIMESTEP);
+            accumulator -= FIXED_TIMESTEP;
+        }
 
         // actualiza el sistema de audio (elimina sonidos terminados)
         audioSystem.update();
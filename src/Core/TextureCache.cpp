@@ -0,0 +1,37 @@
+#include "../include/Core/TextureCache.h"
+#include <iostream>
+
+// carga la textura si no estaba en el cache, un fallo tambien se recuerda para no reintentar
+bool TextureCache::load(const std::string& filepath) {
+    auto it = textures.find(filepath);
+    if (it != textures.end()) {
+        return it->second != nullptr;
+    }
+
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->loadFromFile(filepath)) {
+        std::cerr << "error cargando textura: " << filepath << std::endl;
+        textures[filepath] = nullptr;
+        return false;
+    }
+
+    textures[filepath] = std::move(texture);
+    return true;
+}
+
+
+
+// obtiene la textura compartida de un archivo, o una textura vacia si no existe
+const sf::Texture& TextureCache::get(const std::string& filepath) {
+    if (!load(filepath)) {
+        return emptyTexture;
+    }
+    return *textures[filepath];
+}
+
+
+
+// libera todas las texturas cargadas
+void TextureCache::clear() {
+    textures.clear();
+}
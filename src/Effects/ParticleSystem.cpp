@@ -1,6 +1,7 @@
 #include "../../include/Effects/ParticleSystem.h"
 #include <random>
 #include <cmath>
+#include <algorithm>
 
 
 
@@ -23,17 +24,15 @@ ParticleSystem::ParticleSystem(sf::Vector2f emitterPosition, sf::Vector2f emitte
 // actualiza el sistema de particulas en cada frame
 void ParticleSystem::update(float dt) {
     // actualizar particulas existentes
-    for (size_t i = 0; i < particles.size(); ) {
-        particles[i].update(dt);
-
-        // eliminar particulas que ya expiraron
-        if (particles[i].lifetime <= 0) {
-            particles.erase(particles.begin() + i);
-        } else {
-            i++;
-        }
+    for (auto& particle : particles) {
+        particle.update(dt);
     }
 
+    // eliminar particulas que ya expiraron en una sola pasada
+    particles.erase(std::remove_if(particles.begin(), particles.end(),
+                                   [](const Particle& particle) { return particle.lifetime <= 0; }),
+                    particles.end());
+
     // emitir nuevas particulas segun la tasa de emision
     timeSinceLastEmit += dt;
     float emissionPeriod = 1.0f / emissionRate;
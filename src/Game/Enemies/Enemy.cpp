@@ -1,101 +1,127 @@
 #include "../include/Game/Enemies/Enemy.h"
 #include "../include/Game/Systems/Pathfinding.h"
 #include "../include/Game/Grid/Grid.h"
+#include "../include/Game/Systems/Logger.h"
 #include <cmath>
-#include <iostream>
-#include "Game/Towers/Tower.h"
-#include "../include/Core/AudioSystem.h"
-
-// fuente compartida para mostrar textos flotantes de daño
-sf::Font Enemy::sharedFont;
-
-// referencia al sistema de audio compartido
-AudioSystem* Enemy::audioSystem = nullptr;
 
 // constructor del enemigo con parametros individuales
-Enemy::Enemy(float health, float speed, float arrowRes, float magicRes, float artilleryRes, int goldReward, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path)
+Enemy::Enemy(EnemyType type, float health, float speed, float arrowRes, float magicRes, float artilleryRes, int goldReward, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path)
     :   id(-1),
-        health(health),
-        maxHealth(health),
-        speed(speed),
-        arrowResistance(arrowRes),
-        magicResistance(magicRes),
-        artilleryResistance(artilleryRes),
+        enemyType(type),
         goldReward(goldReward),
-        position(position),
-        isActive(true),
         path(path),
-        currentPathIndex(0),
-        totalDistanceTraveled(0.0f),
-        totalDamageReceived(0.0f) {
+        events(nullptr),
+        ownStore(std::make_unique<EnemyStore>()),
+        store(ownStore.get()),
+        slot(0) {
 
-    // calcular direccion inicial hacia el primer punto del camino
-    if (!path.empty() && currentPathIndex < path.size() - 1) {
-        direction = Pathfinding::getDirection(position, path[currentPathIndex + 1]);
-    }
+    initializeState(health, speed, arrowRes, magicRes, artilleryRes, position);
+}
 
-    // iniciar medicion del tiempo de vida
-    lifeTimer.restart();
+
+
+// constructor del enemigo con atributos calculados por su tipo
+Enemy::Enemy(EnemyType type, const EnemyStats& stats, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path)
+    :   id(-1),
+        enemyType(type),
+        goldReward(stats.goldReward),
+        path(path),
+        events(nullptr),
+        ownStore(std::make_unique<EnemyStore>()),
+        store(ownStore.get()),
+        slot(0) {
+
+    initializeState(stats.health, stats.speed, stats.arrowResistance, stats.magicResistance, stats.artilleryResistance, position);
 }
 
 
 
 // constructor del enemigo basado en cromosoma genetico
-Enemy::Enemy(const Chromosome& chromosome, int goldReward, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path)
+Enemy::Enemy(EnemyType type, const Chromosome& chromosome, int goldReward, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path)
     :   id(-1),
-        health(chromosome.getHealth()),
-        maxHealth(chromosome.getHealth()),
-        speed(chromosome.getSpeed()),
-        arrowResistance(chromosome.getArrowResistance()),
-        magicResistance(chromosome.getMagicResistance()),
-        artilleryResistance(chromosome.getArtilleryResistance()),
+        enemyType(type),
         goldReward(goldReward),
-        position(position),
-        isActive(true),
         path(path),
-        currentPathIndex(0),
-        totalDistanceTraveled(0.0f),
-        totalDamageReceived(0.0f) {
+        events(nullptr),
+        ownStore(std::make_unique<EnemyStore>()),
+        store(ownStore.get()),
+        slot(0) {
 
-    // calcular direccion inicial hacia el primer punto del camino
-    if (!path.empty() && currentPathIndex < path.size() - 1) {
-        direction = Pathfinding::getDirection(position, path[currentPathIndex + 1]);
+    initializeState(chromosome.getHealth(), chromosome.getSpeed(), chromosome.getArrowResistance(),
+                    chromosome.getMagicResistance(), chromosome.getArtilleryResistance(), position);
+}
+
+
+
+// libera la fila del enemigo en el almacen donde vive
+Enemy::~Enemy() {
+    if (store) {
+        store->removeRow(slot);
     }
+}
 
-    // iniciar medicion del tiempo de vida
-    lifeTimer.restart();
+
+
+// reinicia el enemigo con los atributos del cromosoma, los tipos concretos aplican su propia escala
+void Enemy::respawn(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path, const Chromosome& chromosome, int waveNumber) {
+    EnemyStats stats = {chromosome.getHealth(), chromosome.getSpeed(), chromosome.getArrowResistance(),
+                        chromosome.getMagicResistance(), chromosome.getArtilleryResistance(), goldReward};
+    reinitialize(stats, position, path);
+}
+
+
+
+// vuelve al estado de recien construido, el pool ya asigno el almacen donde se crea la fila
+// copiar el camino reutiliza la capacidad del anterior, asi reciclar no pide memoria
+void Enemy::reinitialize(const EnemyStats& stats, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& newPath) {
+    id = -1;
+    goldReward = stats.goldReward;
+    events = nullptr;
+    path = newPath;
+    initializeState(stats.health, stats.speed, stats.arrowResistance, stats.magicResistance, stats.artilleryResistance, position);
 }
 
 
 
-// carga la textura del archivo y configura el sprite
-bool Enemy::loadTexture(const std::string& filename) {
-    if (!texture.loadFromFile(filename)) {
-        return false;
+// crea la fila del enemigo en su almacen con el estado inicial
+void Enemy::initializeState(float health, float speed, float arrowRes, float magicRes, float artilleryRes, const sf::Vector2f& position) {
+    slot = store->addRow(this, &path);
+    store->positions[slot] = position;
+    store->speeds[slot] = speed;
+    store->health[slot] = health;
+    store->maxHealth[slot] = health;
+    store->resistances[static_cast<int>(DamageType::Arrow)][slot] = arrowRes;
+    store->resistances[static_cast<int>(DamageType::Magic)][slot] = magicRes;
+    store->resistances[static_cast<int>(DamageType::Artillery)][slot] = artilleryRes;
+
+    // calcular direccion inicial hacia el primer punto del camino
+    if (!path.empty() && path.size() > 1) {
+        store->directions[slot] = Pathfinding::getDirection(position, path[1]);
     }
 
-    sprite.setTexture(texture);
+    // iniciar medicion del tiempo de vida
+    lifeTimer.restart();
+}
+
 
-    // centrar el origen del sprite para rotaciones correctas
-    sf::FloatRect bounds = sprite.getLocalBounds();
-    sprite.setOrigin(bounds.width / 2, bounds.height / 2);
-    sprite.setPosition(position);
 
-    return true;
+// cantidad de avances por paso de simulacion
+void Enemy::setMovementPasses(int passes) {
+    store->movementPasses[slot] = static_cast<uint8_t>(passes);
 }
 
 
 
 // verifica si el enemigo sigue con vida y activo
 bool Enemy::isAlive() const {
-    return health > 0.f && isActive;
+    return store->health[slot] > 0.f && store->active[slot];
 }
 
 
 
 // verifica si el enemigo alcanzo el final del camino
 bool Enemy::hasReachedEnd() const {
-    return Pathfinding::hasReachedEnd(currentPathIndex, path);
+    return Pathfinding::hasReachedEnd(store->pathIndices[slot], path);
 }
 
 
@@ -109,47 +135,23 @@ int Enemy::getGoldReward() const {
 
 // obtiene la posicion actual del enemigo en el mapa
 sf::Vector2f Enemy::getPosition() const {
-    return position;
+    return store->positions[slot];
 }
 
 
 
-// dibuja el enemigo y sus elementos visuales en pantalla
-void Enemy::draw(sf::RenderTarget& target, sf::RenderStates states) const {
-    if (isActive) {
-        target.draw(sprite, states);
-
-        // dibujar barra de vida con color segun porcentaje de salud
-        sf::RectangleShape healthBar;
-        float healthPercentage = health / maxHealth;
-        healthBar.setSize(sf::Vector2f(40.f * healthPercentage, 5.f));
+// obtiene el tipo de enemigo para elegir su representacion visual
+EnemyType Enemy::getType() const {
+    return enemyType;
+}
 
-        // cambiar color segun porcentaje de vida
-        if (healthPercentage > 0.6f) {
-            healthBar.setFillColor(sf::Color::Green);
-        } else if (healthPercentage > 0.3f) {
-            healthBar.setFillColor(sf::Color::Yellow);
-        } else {
-            healthBar.setFillColor(sf::Color::Red);
-        }
 
-        healthBar.setPosition(position.x - 20.f, position.y - 50.f);
-        target.draw(healthBar, states);
-
-        // dibujar borde negro alrededor de la barra de vida
-        sf::RectangleShape healthBarBorder;
-        healthBarBorder.setSize(sf::Vector2f(40.f, 5.f));
-        healthBarBorder.setFillColor(sf::Color::Transparent);
-        healthBarBorder.setOutlineColor(sf::Color::Black);
-        healthBarBorder.setOutlineThickness(1.f);
-        healthBarBorder.setPosition(position.x - 20.f, position.y - 50.f);
-        target.draw(healthBarBorder, states);
-    }
 
-    // dibujar numeros flotantes que muestran el daño recibido
-    for (const auto& dmgText : floatingTexts) {
-        target.draw(dmgText.text, states);
-    }
+// obtiene la fraccion de vida restante entre 0 y 1
+float Enemy::getHealthPercentage() const {
+    float maxHealth = store->maxHealth[slot];
+    if (maxHealth <= 0.0f) return 0.0f;
+    return store->health[slot] / maxHealth;
 }
 
 
@@ -157,12 +159,24 @@ void Enemy::draw(sf::RenderTarget& target, sf::RenderStates states) const {
 // asigna un nuevo camino para que siga el enemigo
 void Enemy::setPath(const DynamicArray<sf::Vector2f>& newPath) {
     path = newPath;
-    currentPathIndex = 0;
+    store->pathIndices[slot] = 0;
 
     // recalcular direccion hacia el primer punto del nuevo camino
-    if (!path.empty() && currentPathIndex < path.size() - 1) {
-        direction = Pathfinding::getDirection(position, path[currentPathIndex]);
+    if (!path.empty() && path.size() > 1) {
+        store->directions[slot] = Pathfinding::getDirection(store->positions[slot], path[0]);
+    }
+}
+
+
+
+// verifica si el tramo restante del camino pasa por un punto
+bool Enemy::isPathThrough(const sf::Vector2f& point) const {
+    for (size_t i = store->pathIndices[slot]; i < path.size(); i++) {
+        if (Pathfinding::getDistance(path[i], point) < 1.0f) {
+            return true;
+        }
     }
+    return false;
 }
 
 
@@ -174,17 +188,11 @@ void Enemy::recalculatePath(Grid* grid, const sf::Vector2f& goal) {
     }
 
     // buscar nueva ruta desde posicion actual hasta el objetivo
-    auto newPath = Pathfinding::findPath(grid, position, goal);
+    auto newPath = Pathfinding::findPath(grid, store->positions[slot], goal);
 
     if (!newPath.empty()) {
-        // actualizar camino y reiniciar indice
-        path = newPath;
-        currentPathIndex = 0;
-
-        // calcular nueva direccion hacia el primer punto
-        if (path.size() > 1) {
-            direction = Pathfinding::getDirection(position, path[0]);
-        }
+        // actualizar camino, reiniciar indice y direccion
+        setPath(newPath);
     }
 }
 
@@ -206,14 +214,14 @@ int Enemy::getId() const {
 
 // obtiene la distancia total que ha recorrido el enemigo
 float Enemy::getTotalDistanceTraveled() const {
-    return totalDistanceTraveled;
+    return store->distanceTraveled[slot];
 }
 
 
 
 // obtiene el daño total acumulado que ha recibido
 float Enemy::getTotalDamageReceived() const {
-    return totalDamageReceived;
+    return store->damageReceived[slot];
 }
 
 
@@ -227,8 +235,9 @@ float Enemy::getTimeAlive() const {
 
 // calcula que tan efectivo ha sido el daño aplicado
 float Enemy::getDamageEffectiveness() const {
+    float maxHealth = store->maxHealth[slot];
     if (maxHealth <= 0.0f) return 0.0f;
-    return std::min(totalDamageReceived / maxHealth, 2.0f); // limite maximo del 200%
+    return std::min(store->damageReceived[slot] / maxHealth, 2.0f); // limite maximo del 200%
 }
 
 
@@ -239,41 +248,32 @@ void Enemy::receiveDamage(float damage) {
     trackDamage(damage);
 
     // reducir puntos de vida
+    float& health = store->health[slot];
     health -= damage;
 
-    // mostrar numero flotante con el daño
-    createDamageText(damage);
+    // notificar el daño para mostrar el numero flotante
+    if (events) {
+        SimulationEvent event;
+        event.type = SimulationEventType::EnemyDamaged;
+        event.enemyId = id;
+        event.position = store->positions[slot];
+        event.amount = damage;
+        events->push_back(event);
+    }
 
     // marcar como muerto si la vida llega a cero
     if (health <= 0.f) {
         health = 0.f;
-        isActive = false;
-
-        // reproducir sonido de muerte
-        if (audioSystem) {
-            std::cout << "Reproduciendo sonido de muerte para enemigo " << id << "\n";
-            audioSystem->playSound("death");
-        }
+        store->active[slot] = 0;
     }
 }
 
 
 
 // aplica daño considerando resistencias segun el tipo de ataque
-void Enemy::takeDamage(float amount, const std::string& damageType) {
-    float damageMultiplier = 1.0f;
-
-    // calcular multiplicador segun resistencias del enemigo
-    if (damageType == "arrow") {
-        damageMultiplier = arrowResistance;
-    } else if (damageType == "magic") {
-        damageMultiplier = magicResistance;
-    } else if (damageType == "artillery") {
-        damageMultiplier = artilleryResistance;
-    }
-
-    // evitar daño negativo por resistencias muy altas
-    damageMultiplier = std::max(0.0f, damageMultiplier);
+void Enemy::takeDamage(float amount, DamageType damageType) {
+    // multiplicador segun resistencias del enemigo, evitando daño negativo
+    float damageMultiplier = std::max(0.0f, store->resistances[static_cast<int>(damageType)][slot]);
 
     float finalDamage = amount * damageMultiplier;
 
@@ -283,106 +283,45 @@ void Enemy::takeDamage(float amount, const std::string& damageType) {
 
 
 
-// actualiza el estado del enemigo en cada frame
-void Enemy::update(float dt) {
-    // actualizar animaciones de textos flotantes
-    updateFloatingTexts(dt);
-
-    // mover al enemigo si esta vivo y tiene camino
-    if (isActive && !path.empty() && currentPathIndex < path.size()) {
-        updateMovement(dt);
-    }
-}
-
-
-
-// registra el daño recibido para estadisticas y debug
-void Enemy::trackDamage(float damage) {
-    totalDamageReceived += damage;
-
-    // mensaje de debug para seguimiento del daño
-    if (damage > 0) {
-        std::cout << "Enemigo " << id << " recibió " << damage
-                  << " de daño. Total acumulado: " << totalDamageReceived << "\n";
+// aplica una lista de impactos en orden, se saltan los objetivos que ya murieron
+void Enemy::applyDamage(const DynamicArray<DamageHit>& hits) {
+    for (const DamageHit& hit : hits) {
+        if (hit.target->isAlive()) {
+            hit.target->takeDamage(hit.amount, hit.type);
+        }
     }
 }
 
 
 
-// crea un texto flotante que muestra el daño recibido
-void Enemy::createDamageText(float damage) {
-    FloatingDamageText damageText;
-    damageText.text.setFont(sharedFont);
-    damageText.text.setCharacterSize(16);
-    damageText.text.setFillColor(sf::Color::Red);
-    damageText.text.setString("-" + std::to_string(static_cast<int>(damage)));
-
-    // centrar el texto
-    sf::FloatRect bounds = damageText.text.getLocalBounds();
-    damageText.text.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-
-    // posicionar encima del enemigo con variacion aleatoria
-    float offsetX = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 20.0f;
-    damageText.text.setPosition(position.x + offsetX, position.y - 60.f);
-
-    floatingTexts.push_back(damageText);
+// avanza solo a este enemigo, la simulacion mueve a todos juntos con EnemyStore::advance
+void Enemy::update(float dt) {
+    store->advanceSlot(slot, dt);
 }
 
 
 
-// actualiza la animacion de los textos de daño flotantes
-void Enemy::updateFloatingTexts(float dt) {
-    for (size_t i = 0; i < floatingTexts.size(); ) {
-        float t = floatingTexts[i].timer.getElapsedTime().asSeconds();
-
-        // eliminar texto despues de 0.8 segundos
-        if (t > 0.8f) {
-            floatingTexts.erase(i);
-        } else {
-            // mover el texto hacia arriba
-            sf::Vector2f pos = floatingTexts[i].text.getPosition();
-            pos.y -= 20.f * dt;
-            floatingTexts[i].text.setPosition(pos);
-
-            // aplicar efecto de desvanecimiento gradual
-            sf::Color color = floatingTexts[i].text.getFillColor();
-            color.a = static_cast<sf::Uint8>(255 * (1.0f - t / 0.8f));
-            floatingTexts[i].text.setFillColor(color);
+// registra el daño recibido para estadisticas y debug
+void Enemy::trackDamage(float damage) {
+    float& totalDamageReceived = store->damageReceived[slot];
+    totalDamageReceived += damage;
 
-            ++i;
-        }
+    // mensaje de debug para seguimiento del daño, desaparece al compilar sin el nivel debug
+    if (damage > 0) {
+        GK_LOG_DEBUG("Enemigo {} recibió {} de daño. Total acumulado: {}", id, damage, totalDamageReceived);
     }
 }
 
 
 
-// actualiza la posicion y movimiento del enemigo
-void Enemy::updateMovement(float dt) {
-    sf::Vector2f oldPosition = position;
-    position = Pathfinding::moveAlongPath(position, path, currentPathIndex, speed, dt);
-    sprite.setPosition(position);
-
-    // calcular distancia recorrida en este frame para estadisticas
-    sf::Vector2f deltaPos = position - oldPosition;
-    float distance = std::sqrt(deltaPos.x * deltaPos.x + deltaPos.y * deltaPos.y);
-    totalDistanceTraveled += distance;
-
-    // actualizar direccion hacia el siguiente punto del camino
-    if (currentPathIndex < path.size()) {
-        sf::Vector2f nextPoint = path[currentPathIndex];
-        sf::Vector2f moveDirection = Pathfinding::getDirection(position, nextPoint);
-        direction = moveDirection;
-    }
+// conecta el enemigo con la cola de eventos de la simulacion
+void Enemy::setEventQueue(SimulationEventQueue* queue) {
+    events = queue;
 }
 
 
 
-// establece la fuente que usaran todos los enemigos para textos
-void Enemy::setSharedFont(const sf::Font& font) {
-    sharedFont = font;
+// asigna el reloj de la simulacion y comienza a medir el tiempo de vida
+void Enemy::setClock(const SimClock* clock) {
+    lifeTimer.setClock(clock);
 }
-
-// establece el sistema de audio compartido para todos los enemigos
-void Enemy::setAudioSystem(AudioSystem* audio) {
-    audioSystem = audio;
-}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "../include/Game/Enemies/EnemyPool.h"
+
+// crea un pool vacio que trabaja sobre el almacen de la simulacion
+EnemyPool::EnemyPool(EnemyStore& store)
+    :   store(store),
+        inUse(0),
+        highWater(0),
+        created(0),
+        recycled(0) {
+}
+
+
+
+// toma el ultimo enemigo libre del tipo y lo reinicia en una fila nueva del almacen
+std::unique_ptr<Enemy> EnemyPool::acquire(EnemyType type, const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path,
+                                          const Chromosome& chromosome, int waveNumber) {
+    DynamicArray<std::unique_ptr<Enemy>>& list = freeEnemies[static_cast<int>(type)];
+    if (list.empty()) {
+        return nullptr;
+    }
+
+    std::unique_ptr<Enemy> enemy = std::move(list[list.size() - 1]);
+    list.erase(list.size() - 1);
+
+    enemy->store = &store;
+    enemy->respawn(position, path, chromosome, waveNumber);
+    recycled++;
+    return enemy;
+}
+
+
+
+// mueve la fila del enemigo al almacen si aun no esta y actualiza el maximo simultaneo
+void EnemyPool::adopt(Enemy& enemy) {
+    if (enemy.store != &store) {
+        store.attach(enemy);
+        created++;
+    }
+
+    inUse++;
+    if (inUse > highWater) {
+        highWater = inUse;
+    }
+}
+
+
+
+// libera la fila en tiempo constante y deja al enemigo desconectado hasta que se reutilice
+void EnemyPool::release(std::unique_ptr<Enemy> enemy) {
+    if (!enemy) return;
+
+    if (enemy->store) {
+        enemy->store->removeRow(enemy->slot);
+        enemy->store = nullptr;
+    }
+    enemy->events = nullptr;
+
+    if (inUse > 0) {
+        inUse--;
+    }
+    freeEnemies[static_cast<int>(enemy->getType())].push_back(std::move(enemy));
+}
+
+
+
+// cantidad de enemigos guardados en todas las listas libres
+size_t EnemyPool::getFreeCount() const {
+    size_t count = 0;
+    for (const auto& list : freeEnemies) {
+        count += list.size();
+    }
+    return count;
+}
@@ -0,0 +1,147 @@
+#include "../include/Game/Enemies/EnemyStore.h"
+#include "../include/Game/Enemies/Enemy.h"
+#include <cmath>
+
+// agrega una fila con valores neutros para un enemigo
+size_t EnemyStore::addRow(Enemy* owner, const DynamicArray<sf::Vector2f>* path) {
+    positions.push_back(sf::Vector2f(0.0f, 0.0f));
+    directions.push_back(sf::Vector2f(0.0f, 0.0f));
+    speeds.push_back(0.0f);
+    health.push_back(0.0f);
+    maxHealth.push_back(0.0f);
+    for (auto& column : resistances) {
+        column.push_back(1.0f);
+    }
+    pathIndices.push_back(0);
+    paths.push_back(path);
+    active.push_back(1);
+    movementPasses.push_back(1);
+    distanceTraveled.push_back(0.0f);
+    damageReceived.push_back(0.0f);
+    owners.push_back(owner);
+    return owners.size() - 1;
+}
+
+
+
+// copia el estado de una fila de otro almacen, sin tocar duenio ni camino
+void EnemyStore::copyRow(size_t slot, const EnemyStore& from, size_t fromSlot) {
+    positions[slot] = from.positions[fromSlot];
+    directions[slot] = from.directions[fromSlot];
+    speeds[slot] = from.speeds[fromSlot];
+    health[slot] = from.health[fromSlot];
+    maxHealth[slot] = from.maxHealth[fromSlot];
+    for (int type = 0; type < DAMAGE_TYPE_COUNT; type++) {
+        resistances[type][slot] = from.resistances[type][fromSlot];
+    }
+    pathIndices[slot] = from.pathIndices[fromSlot];
+    active[slot] = from.active[fromSlot];
+    movementPasses[slot] = from.movementPasses[fromSlot];
+    distanceTraveled[slot] = from.distanceTraveled[fromSlot];
+    damageReceived[slot] = from.damageReceived[fromSlot];
+}
+
+
+
+// quita una fila en tiempo constante, la ultima fila ocupa su lugar y se corrige la fila de su duenio
+void EnemyStore::removeRow(size_t slot) {
+    positions.swap_remove(slot);
+    directions.swap_remove(slot);
+    speeds.swap_remove(slot);
+    health.swap_remove(slot);
+    maxHealth.swap_remove(slot);
+    for (auto& column : resistances) {
+        column.swap_remove(slot);
+    }
+    pathIndices.swap_remove(slot);
+    paths.swap_remove(slot);
+    active.swap_remove(slot);
+    movementPasses.swap_remove(slot);
+    distanceTraveled.swap_remove(slot);
+    damageReceived.swap_remove(slot);
+    owners.swap_remove(slot);
+
+    if (slot < owners.size()) {
+        owners[slot]->slot = slot;
+    }
+}
+
+
+
+// traslada al enemigo desde su almacen actual a este
+void EnemyStore::attach(Enemy& enemy) {
+    if (enemy.store == this) return;
+
+    size_t slot = addRow(&enemy, &enemy.path);
+    copyRow(slot, *enemy.store, enemy.slot);
+
+    enemy.store->removeRow(enemy.slot);
+    enemy.store = this;
+    enemy.slot = slot;
+    enemy.ownStore.reset();
+}
+
+
+
+// direccion normalizada y distancia hacia un punto con una sola raiz
+static inline float directionTo(const sf::Vector2f& from, const sf::Vector2f& to, sf::Vector2f& direction) {
+    direction = to - from;
+    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    if (length > 0.0001f) {
+        direction /= length;
+    }
+    return length;
+}
+
+
+
+// un avance a lo largo del camino para una fila, mismo calculo que Pathfinding::moveAlongPath
+void EnemyStore::movePass(size_t slot, float dt) {
+    const DynamicArray<sf::Vector2f>& path = *paths[slot];
+    size_t& pathIndex = pathIndices[slot];
+    if (!active[slot] || path.empty() || pathIndex >= path.size()) {
+        return;
+    }
+
+    sf::Vector2f oldPosition = positions[slot];
+    sf::Vector2f moveDirection;
+    float distance = directionTo(oldPosition, path[pathIndex], moveDirection);
+
+    // al llegar al punto actual pasar al siguiente
+    if (distance < ARRIVAL_THRESHOLD) {
+        pathIndex++;
+        if (pathIndex >= path.size()) {
+            return;
+        }
+        directionTo(oldPosition, path[pathIndex], moveDirection);
+    }
+
+    sf::Vector2f position = oldPosition + moveDirection * speeds[slot] * dt;
+    positions[slot] = position;
+
+    // calcular distancia recorrida en este paso para estadisticas
+    sf::Vector2f deltaPos = position - oldPosition;
+    distanceTraveled[slot] += std::sqrt(deltaPos.x * deltaPos.x + deltaPos.y * deltaPos.y);
+
+    // actualizar direccion hacia el siguiente punto del camino
+    directionTo(position, path[pathIndex], directions[slot]);
+}
+
+
+
+// avanza una sola fila tantas veces como indique su tipo
+void EnemyStore::advanceSlot(size_t slot, float dt) {
+    for (int pass = 0; pass < movementPasses[slot]; pass++) {
+        movePass(slot, dt);
+    }
+}
+
+
+
+// recorre las columnas en orden, sin llamadas virtuales por enemigo
+void EnemyStore::advance(float dt) {
+    size_t count = owners.size();
+    for (size_t slot = 0; slot < count; slot++) {
+        advanceSlot(slot, dt);
+    }
+}
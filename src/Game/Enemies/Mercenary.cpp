@@ -13,88 +13,30 @@ const float MERCENARY_ARTILLERY_RESISTANCE = 0.6f;      // resistencia a artille
 
 // constructor base
 Mercenary::Mercenary(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path)
-    : Enemy(MERCENARY_BASE_HEALTH, MERCENARY_BASE_SPEED, MERCENARY_ARROW_RESISTANCE, MERCENARY_MAGIC_RESISTANCE, MERCENARY_ARTILLERY_RESISTANCE, 25, position, path) {
-
-    if (!loadTexture("assets/images/enemies/mercenary.png")) {
-        std::cerr << "error al cargar imagen: mercenario" << std::endl;
-    }
+    : Enemy(EnemyType::Mercenary, MERCENARY_BASE_HEALTH, MERCENARY_BASE_SPEED, MERCENARY_ARROW_RESISTANCE, MERCENARY_MAGIC_RESISTANCE, MERCENARY_ARTILLERY_RESISTANCE, 25, position, path) {
+    setMovementPasses(2); // avanza dos veces por paso de simulacion
+}
 
-    sprite.setScale(0.11f, 0.11f);
-    sprite.setRotation(0.0f);
+// atributos del mercenario segun el cromosoma y la oleada
+static EnemyStats mercenaryStats(const Chromosome& chromosome, int waveNumber) {
+    return {
+        MERCENARY_BASE_HEALTH * (0.7f + (chromosome.getHealth() / 300.0f) * 0.6f) * std::pow(1.35f, static_cast<float>(waveNumber)),
+        MERCENARY_BASE_SPEED * (0.8f + (chromosome.getSpeed() / 100.0f) * 0.4f) * std::pow(1.05f, static_cast<float>(waveNumber)),
+        MERCENARY_ARROW_RESISTANCE * (0.9f + (chromosome.getArrowResistance() / 2.0f) * 0.2f) * std::pow(1.1f, static_cast<float>(waveNumber)),
+        MERCENARY_MAGIC_RESISTANCE * (1.1f + (chromosome.getMagicResistance() / 2.0f) * 0.4f) * std::pow(1.1f, static_cast<float>(waveNumber)),
+        MERCENARY_ARTILLERY_RESISTANCE * (1.1f + (chromosome.getArtilleryResistance() / 2.0f) * 0.4f) * std::pow(1.1f, static_cast<float>(waveNumber)),
+        15 + static_cast<int>(std::pow(1.35f, waveNumber))
+    };
 }
 
 // constructor con cromosoma
 Mercenary::Mercenary(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path, const Chromosome& chromosome, int waveNumber)
-    : Enemy(
-    MERCENARY_BASE_HEALTH * (0.7f + (chromosome.getHealth() / 300.0f) * 0.6f) * std::pow(1.35f, static_cast<float>(waveNumber)),
-    MERCENARY_BASE_SPEED * (0.8f + (chromosome.getSpeed() / 100.0f) * 0.4f) * std::pow(1.05f, static_cast<float>(waveNumber)),
-    MERCENARY_ARROW_RESISTANCE * (0.9f + (chromosome.getArrowResistance() / 2.0f) * 0.2f) * std::pow(1.1f, static_cast<float>(waveNumber)),
-    MERCENARY_MAGIC_RESISTANCE * (1.1f + (chromosome.getMagicResistance() / 2.0f) * 0.4f) * std::pow(1.1f, static_cast<float>(waveNumber)),
-    MERCENARY_ARTILLERY_RESISTANCE * (1.1f + (chromosome.getArtilleryResistance() / 2.0f) * 0.4f) * std::pow(1.1f, static_cast<float>(waveNumber)),
-    15 + static_cast<int>(std::pow(1.35f, waveNumber)), position, path){
-
-    if (!loadTexture("assets/images/enemies/Mercenary.png")) {
-        std::cerr << "error al cargar imagen: Mercenario" << std::endl;
-    }
-
-    sprite.setScale(0.13f, 0.13f);
-    sprite.setRotation(0.0f);
-}
-
-// actualización por frame
-void Mercenary::update(float dt) {
-    Enemy::update(dt);
-    if (!isActive || path.empty() || currentPathIndex >= path.size()) {
-        return;
-    }
-
-    sf::Vector2f oldPosition = position;
-    position = Pathfinding::moveAlongPath(position, path, currentPathIndex, speed, dt);
-    sprite.setPosition(position);
-
-    sf::Vector2f deltaPos = position - oldPosition;
-    float distance = std::sqrt(deltaPos.x * deltaPos.x + deltaPos.y * deltaPos.y);
-    totalDistanceTraveled += distance;
-
-    if (currentPathIndex < path.size()) {
-        sf::Vector2f nextPoint = path[currentPathIndex];
-        sf::Vector2f moveDirection = Pathfinding::getDirection(position, nextPoint);
-        direction = moveDirection;
-    }
+    : Enemy(EnemyType::Mercenary, mercenaryStats(chromosome, waveNumber), position, path) {
+    setMovementPasses(2); // avanza dos veces por paso de simulacion
 }
 
-// recibir daño
-void Mercenary::takeDamage(float amount, const std::string& damageType) {
-    float damageMultiplier = 1.0f;
-
-    if (damageType == "arrow") {
-        damageMultiplier = arrowResistance;
-    } else if (damageType == "magic") {
-        damageMultiplier = magicResistance;
-    } else if (damageType == "artillery") {
-        damageMultiplier = artilleryResistance;
-    }
-
-    float finalDamage = amount * damageMultiplier;
-    Enemy::receiveDamage(finalDamage);
-
-    // Crear texto flotante
-    FloatingDamageText damageText;
-    damageText.text.setFont(sharedFont);
-    damageText.text.setCharacterSize(16);
-    damageText.text.setFillColor(sf::Color::Red);
-    damageText.text.setString("-" + std::to_string(static_cast<int>(finalDamage)));
-
-    sf::FloatRect bounds = damageText.text.getLocalBounds();
-    damageText.text.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-
-    // Posición encima del enemigo
-    damageText.text.setPosition(position.x, position.y - 60.f);
-
-    floatingTexts.push_back(damageText);
-
-    if (health <= 0) {
-        health = 0;
-        isActive = false;
-    }
+// reinicia un mercenario reciclado con los atributos de su nuevo cromosoma
+void Mercenary::respawn(const sf::Vector2f& position, const DynamicArray<sf::Vector2f>& path, const Chromosome& chromosome, int waveNumber) {
+    reinitialize(mercenaryStats(chromosome, waveNumber), position, path);
+    setMovementPasses(2); // avanza dos veces por paso de simulacion
 }
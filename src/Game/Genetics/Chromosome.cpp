@@ -1,25 +1,27 @@
 #include "../include/Game/Genetics/Chromosome.h"
+#include "../include/Game/Systems/Logger.h"
 #include <algorithm>
-#include <ctime>
-#include <iostream>
 #include <cmath>
 
-// generador de numeros aleatorios compartido por todos los cromosomas
-std::mt19937 Chromosome::randomGenerator(static_cast<unsigned int>(std::time(nullptr)));
+// crea un cromosoma con valores intermedios, usado como marcador sin consumir aleatoriedad
+Chromosome::Chromosome()
+    : health(200.0f), speed(70.0f), arrowResistance(1.0f),
+      magicResistance(1.0f), artilleryResistance(1.0f), fitness(0.0f) {
+}
 
 
 
 // crea un cromosoma con valores aleatorios dentro de rangos validos
-Chromosome::Chromosome() {
+Chromosome::Chromosome(RandomStream& rng) {
     std::uniform_real_distribution<float> healthDist(100.0f, 300.0f);
     std::uniform_real_distribution<float> speedDist(40.0f, 100.0f);
     std::uniform_real_distribution<float> resistanceDist(0.0f, 2.0f);
 
-    health = healthDist(randomGenerator);
-    speed = speedDist(randomGenerator);
-    arrowResistance = resistanceDist(randomGenerator);
-    magicResistance = resistanceDist(randomGenerator);
-    artilleryResistance = resistanceDist(randomGenerator);
+    health = healthDist(rng);
+    speed = speedDist(rng);
+    arrowResistance = resistanceDist(rng);
+    magicResistance = resistanceDist(rng);
+    artilleryResistance = resistanceDist(rng);
 
     fitness = 0.0f;
 }
@@ -85,25 +87,23 @@ void Chromosome::calculateFitness(bool reachedEnd, float distanceTraveled, float
     }
 
     // mostrar informacion detallada del calculo de fitness
-    std::cout << "Fitness calculado: " << fitness
-              << " (distancia: " << normalizedDistance * 100 << "%"
-              << ", tiempo: " << timeAlive << "s"
-              << ", llegó: " << (reachedEnd ? "SÍ" : "NO") << ")\n";
+    GK_LOG_DEBUG("Fitness calculado: {} (distancia: {}%, tiempo: {}s, llegó: {})",
+                 fitness, normalizedDistance * 100, timeAlive, reachedEnd ? "SÍ" : "NO");
 }
 
 
 
 // combina genes de dos cromosomas para crear descendencia
-Chromosome Chromosome::crossover(const Chromosome &other) const {
+Chromosome Chromosome::crossover(const Chromosome &other, RandomStream& rng) const {
     std::uniform_real_distribution<float> weightDist(0.2f, 0.8f);
     std::uniform_int_distribution<int> methodDist(0, 1);
 
     Chromosome child;
 
     // elegir metodo de cruzamiento aleatoriamente
-    if (methodDist(randomGenerator) == 0) {
+    if (methodDist(rng) == 0) {
         // cruzamiento aritmetico - mezcla ponderada de genes
-        float w1 = weightDist(randomGenerator);
+        float w1 = weightDist(rng);
         float w2 = 1.0f - w1;
 
         child = Chromosome(
@@ -116,7 +116,7 @@ Chromosome Chromosome::crossover(const Chromosome &other) const {
     } else {
         // cruzamiento de un punto - corte en posicion aleatoria
         std::uniform_int_distribution<int> pointDist(1, 4);
-        int crossPoint = pointDist(randomGenerator);
+        int crossPoint = pointDist(rng);
 
         switch (crossPoint) {
             case 1:
@@ -141,12 +141,11 @@ Chromosome Chromosome::crossover(const Chromosome &other) const {
 
 
 // aplica mutaciones aleatorias para mantener diversidad genetica
-void Chromosome::mutate(float mutationRate) {
+void Chromosome::mutate(float mutationRate, RandomStream& rng) {
     std::uniform_real_distribution<float> mutationChance(0.0f, 1.0f);
 
     // ajustar intensidad de mutacion segun fitness actual
-    float adaptiveFactor = (fitness < 100.0f) ? 2.0f :
-                          (fitness < 300.0f) ? 1.2f : 0.8f;
+    float adaptiveFactor = mutationFactor(fitness);
 
     // distribuciones normales para cambios graduales
     std::normal_distribution<float> healthMut(0.0f, 40.0f * adaptiveFactor);
@@ -154,28 +153,28 @@ void Chromosome::mutate(float mutationRate) {
     std::normal_distribution<float> resMut(0.0f, 0.25f * adaptiveFactor);
 
     // aplicar mutacion a cada gen segun probabilidad
-    if (mutationChance(randomGenerator) < mutationRate) {
-        health += healthMut(randomGenerator);
+    if (mutationChance(rng) < mutationRate) {
+        health += healthMut(rng);
         health = std::max(50.0f, std::min(350.0f, health));
     }
 
-    if (mutationChance(randomGenerator) < mutationRate) {
-        speed += speedMut(randomGenerator);
+    if (mutationChance(rng) < mutationRate) {
+        speed += speedMut(rng);
         speed = std::max(20.0f, std::min(120.0f, speed));
     }
 
-    if (mutationChance(randomGenerator) < mutationRate) {
-        arrowResistance += resMut(randomGenerator);
+    if (mutationChance(rng) < mutationRate) {
+        arrowResistance += resMut(rng);
         arrowResistance = std::clamp(arrowResistance, 0.0f, 2.5f);
     }
 
-    if (mutationChance(randomGenerator) < mutationRate) {
-        magicResistance += resMut(randomGenerator);
+    if (mutationChance(rng) < mutationRate) {
+        magicResistance += resMut(rng);
         magicResistance = std::clamp(magicResistance, 0.0f, 2.5f);
     }
 
-    if (mutationChance(randomGenerator) < mutationRate) {
-        artilleryResistance += resMut(randomGenerator);
+    if (mutationChance(rng) < mutationRate) {
+        artilleryResistance += resMut(rng);
         artilleryResistance = std::clamp(artilleryResistance, 0.0f, 2.5f);
     }
 
@@ -184,6 +183,14 @@ void Chromosome::mutate(float mutationRate) {
 
 
 
+// intensidad de la mutacion segun el fitness, los individuos debiles mutan mas
+float Chromosome::mutationFactor(float fitness) {
+    return (fitness < 100.0f) ? 2.0f :
+           (fitness < 300.0f) ? 1.2f : 0.8f;
+}
+
+
+
 // mide que tan diferentes son dos cromosomas para diversidad
 float Chromosome::calculateDiversity(const Chromosome& other) const {
     float totalDiff = 0.0f;
@@ -228,4 +235,5 @@ float Chromosome::getSpeed() const { return speed; }
 float Chromosome::getArrowResistance() const { return arrowResistance; }
 float Chromosome::getMagicResistance() const { return magicResistance; }
 float Chromosome::getArtilleryResistance() const { return artilleryResistance; }
-float Chromosome::getFitness() const { return fitness; }
\ No newline at end of file
+float Chromosome::getFitness() const { return fitness; }
+void Chromosome::setFitness(float value) { fitness = value; }
\ No newline at end of file
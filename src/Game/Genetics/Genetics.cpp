@@ -1,17 +1,20 @@
 #include "../include/Game/Genetics//Genetics.h"
+#include "../include/Game/Systems/Logger.h"
 #include <algorithm>
 #include <numeric>
 #include <iostream>
 
 // configura los parametros del algoritmo genetico
-Genetics::Genetics(int populationSize, float mutationRate, float crossoverRate)
+Genetics::Genetics(int populationSize, float mutationRate, float crossoverRate, RandomService& random)
     : populationSize(populationSize), mutationRate(mutationRate), crossoverRate(crossoverRate),
-      generation(0), mutationCount(0), pathTotalLength(1000.0f), averageDiversity(1.0f),
-      convergenceThreshold(0.05f) {
-
-    // configurar generador aleatorio con semilla variable
-    std::random_device rd;
-    randomGenerator = std::mt19937(rd());
+      generation(0), mutationCount(0), pathTotalLength(1000.0f),
+      randomGenerator(random.stream(RandomSubsystem::Genetics)),
+      chromosomeRandom(random.stream(RandomSubsystem::Chromosomes)),
+      breedingStream(random.stream(RandomSubsystem::Breeding)),
+      breedingMode(BreedingMode::Batch),
+      selectionStrategy(SelectionStrategy::Roulette),
+      population(&generations[0]), nextPopulation(&generations[1]),
+      averageDiversity(1.0f), convergenceThreshold(0.05f), scratch(nullptr) {
 
     // crear poblacion inicial con cromosomas aleatorios
     initializePopulation();
@@ -21,10 +24,10 @@ Genetics::Genetics(int populationSize, float mutationRate, float crossoverRate)
 
 // crea la poblacion inicial con cromosomas generados aleatoriamente
 void Genetics::initializePopulation() {
-    population.clear();
+    population->clear();
 
     for (int i = 0; i < populationSize; ++i) {
-        population.push_back(Chromosome());
+        population->push_back(Chromosome(chromosomeRandom));
     }
 
     std::cout << "Población inicializada con " << populationSize << " cromosomas\n";
@@ -35,156 +38,203 @@ void Genetics::initializePopulation() {
 // evalua el rendimiento de todos los cromosomas en la poblacion
 void Genetics::evaluatePopulation(const DynamicArray<bool> &reachedEnd, const DynamicArray<float> &distancesTraveled, const DynamicArray<float> &damagesDealt, const DynamicArray<float> &timesAlive) {
 
-    std::cout << "=== DEBUG evaluatePopulation ===\n";
-    std::cout << "reachedEnd.size(): " << reachedEnd.size() << "\n";
-    std::cout << "population.size(): " << population.size() << "\n";
+    GK_LOG_DEBUG("=== DEBUG evaluatePopulation ===");
+    GK_LOG_DEBUG("reachedEnd.size(): {}", reachedEnd.size());
+    GK_LOG_DEBUG("population.size(): {}", population->size());
 
     // verificar consistencia en el tamano de los datos de rendimiento
     size_t dataSize = reachedEnd.size();
     if (dataSize != distancesTraveled.size() || dataSize != damagesDealt.size() || dataSize != timesAlive.size()) {
-        std::cout << "ERROR: Datos de performance inconsistentes\n";
+        GK_LOG_ERROR("ERROR: Datos de performance inconsistentes");
         return;
     }
 
     // manejar caso sin datos de rendimiento
     if (dataSize == 0) {
-        std::cout << "No hay datos de performance - asignando fitness base\n";
-        for (auto& chromosome : population) {
+        GK_LOG_INFO("No hay datos de performance - asignando fitness base");
+        for (size_t i = 0; i < population->size(); ++i) {
+            Chromosome chromosome = population->get(i);
             chromosome.calculateFitness(false, 0.0f, 0.0f, 0.0f, pathTotalLength);
+            population->setFitness(i, chromosome.getFitness());
         }
         return;
     }
 
-    std::cout << "Evaluando " << dataSize << " cromosomas con datos de performance...\n";
+    GK_LOG_INFO("Evaluando {} cromosomas con datos de performance...", dataSize);
 
     // evaluar cada cromosoma con sus datos de rendimiento correspondientes
     size_t chromoIndex = 0;
-    for (size_t i = 0; i < dataSize && chromoIndex < population.size(); ++i) {
+    for (size_t i = 0; i < dataSize && chromoIndex < population->size(); ++i) {
         // usar cromosomas de forma ciclica si hay mas datos que cromosomas
-        size_t popIndex = i % population.size();
+        size_t popIndex = i % population->size();
 
-        std::cout << "Evaluando cromosoma " << popIndex
-                  << " - reachedEnd: " << reachedEnd[i]
-                  << ", distancia: " << distancesTraveled[i]
-                  << ", daño: " << damagesDealt[i]
-                  << ", tiempo: " << timesAlive[i] << "\n";
+        GK_LOG_DEBUG("Evaluando cromosoma {} - reachedEnd: {}, distancia: {}, daño: {}, tiempo: {}",
+                     popIndex, reachedEnd[i], distancesTraveled[i], damagesDealt[i], timesAlive[i]);
 
-        population[popIndex].calculateFitness(reachedEnd[i], distancesTraveled[i],
-                                            damagesDealt[i], timesAlive[i], pathTotalLength);
+        Chromosome chromosome = population->get(popIndex);
+        chromosome.calculateFitness(reachedEnd[i], distancesTraveled[i],
+                                    damagesDealt[i], timesAlive[i], pathTotalLength);
+        population->setFitness(popIndex, chromosome.getFitness());
 
-        std::cout << "Fitness calculado: " << population[popIndex].getFitness() << "\n";
+        GK_LOG_DEBUG("Fitness calculado: {}", chromosome.getFitness());
     }
 
     // asignar fitness por defecto a cromosomas no evaluados
     float avgFitness = getAverageFitness();
-    for (size_t i = dataSize; i < population.size(); ++i) {
-        if (population[i].getFitness() == 0.0f) {
-            population[i].calculateFitness(false, pathTotalLength * 0.3f, 10.0f, 5.0f, pathTotalLength);
-            std::cout << "Cromosoma " << i << " evaluado con datos default, fitness: "
-                      << population[i].getFitness() << "\n";
+    for (size_t i = dataSize; i < population->size(); ++i) {
+        if (population->getFitness(i) == 0.0f) {
+            Chromosome chromosome = population->get(i);
+            chromosome.calculateFitness(false, pathTotalLength * 0.3f, 10.0f, 5.0f, pathTotalLength);
+            population->setFitness(i, chromosome.getFitness());
+            GK_LOG_DEBUG("Cromosoma {} evaluado con datos default, fitness: {}", i, chromosome.getFitness());
         }
     }
 
     // actualizar metrica de diversidad poblacional
     averageDiversity = getDiversityMetric();
 
-    std::cout << "Diversidad promedio: " << averageDiversity << "\n";
-    std::cout << "=== FIN DEBUG evaluatePopulation ===\n";
+    GK_LOG_INFO("Diversidad promedio: {}", averageDiversity);
+    GK_LOG_DEBUG("=== FIN DEBUG evaluatePopulation ===");
 }
 
 
 
 // selecciona cromosomas padres para reproduccion usando elitismo y torneo
-DynamicArray<Chromosome> Genetics::selectParents() {
-    DynamicArray<Chromosome> selectedParents;
+// el resultado sale de resource, por ejemplo una arena que se limpia cada paso
+DynamicArray<Chromosome> Genetics::selectParents(MemoryResource* resource) {
+    selectParentRows(parentRows);
+
+    DynamicArray<Chromosome> selectedParents(resource);
+    selectedParents.reserve(parentRows.size());
+    for (int row : parentRows) {
+        selectedParents.push_back(population->get(row));
+    }
+
+    return selectedParents;
+}
 
-    // ordenar poblacion por fitness de mayor a menor
-    DynamicArray<Chromosome> sortedPopulation = population;
-    std::sort(sortedPopulation.begin(), sortedPopulation.end(),
-        [](const Chromosome& a, const Chromosome& b) {
-            return a.getFitness() > b.getFitness();
-        });
 
-    // aplicar elitismo conservando los mejores individuos
+
+// elige las filas de los padres usando elitismo y luego ruleta o torneo segun diversidad
+// trabaja con indices, ningun individuo se copia para seleccionar
+// la ruleta se arma una vez por generacion, cada giro cuesta O(log n) o O(1) en lugar de recorrer la poblacion
+void Genetics::selectParentRows(DynamicArray<int>& rows) {
+    rows.clear();
+    rows.reserve(populationSize);
+
+    // aplicar elitismo conservando los mejores individuos, sin ordenar al resto
     int eliteCount = std::max(1, static_cast<int>(populationSize * 0.05f));
 
     std::cout << "Selección: manteniendo " << eliteCount << " individuos elite\n";
 
-    for (int i = 0; i < eliteCount; i++) {
-        selectedParents.push_back(sortedPopulation[i]);
+    population->topRows(orderRows, eliteCount);
+    for (int row : orderRows) {
+        rows.push_back(row);
     }
 
-    // calcular suma total de fitness para seleccion por ruleta
-    float totalFitness = 0.0f;
-    for (const auto& chromosome : population) {
-        totalFitness += std::max(0.1f, chromosome.getFitness()); // evitar fitness cero
-    }
+    // sumas acumuladas de fitness para seleccion por ruleta, el fitness minimo evita pesos cero
+    const DynamicArray<float>& fitness = population->getFitness();
+    roulette.build(fitness);
+    float totalFitness = roulette.total();
 
     // seleccionar el resto usando torneo o ruleta segun diversidad
     const int tournamentSize = 3;
-    std::uniform_int_distribution<int> popDist(0, population.size() - 1);
-
-    for (int i = eliteCount; i < populationSize; ++i) {
-        if (totalFitness > 0.0f && averageDiversity > convergenceThreshold) {
-            // seleccion por ruleta cuando hay suficiente diversidad
+    int remaining = populationSize - static_cast<int>(rows.size());
+    std::uniform_int_distribution<int> popDist(0, population->size() - 1);
+
+    if (totalFitness > 0.0f && averageDiversity > convergenceThreshold) {
+        // seleccion por ruleta cuando hay suficiente diversidad
+        if (selectionStrategy == SelectionStrategy::StochasticUniversal) {
+            roulette.universal(randomGenerator, remaining, rows);
+        } else if (selectionStrategy == SelectionStrategy::Alias) {
+            for (int i = 0; i < remaining; ++i) {
+                rows.push_back(roulette.drawAlias(randomGenerator));
+            }
+        } else {
             std::uniform_real_distribution<float> dist(0.0f, totalFitness);
-            float spinValue = dist(randomGenerator);
-            float currentSum = 0.0f;
-
-            for (const auto& chromosome : population) {
-                currentSum += std::max(0.1f, chromosome.getFitness());
-                if (currentSum >= spinValue) {
-                    selectedParents.push_back(chromosome);
-                    break;
+            for (int i = 0; i < remaining; ++i) {
+                int row = roulette.spin(dist(randomGenerator));
+                if (row >= 0) {
+                    rows.push_back(row);
                 }
             }
-        } else {
-            // seleccion por torneo cuando hay poca diversidad
-            Chromosome best = population[popDist(randomGenerator)];
+        }
+    } else {
+        // seleccion por torneo cuando hay poca diversidad
+        for (int i = 0; i < remaining; ++i) {
+            int best = popDist(randomGenerator);
 
             for (int j = 1; j < tournamentSize; j++) {
-                Chromosome candidate = population[popDist(randomGenerator)];
-                if (candidate.getFitness() > best.getFitness()) {
+                int candidate = popDist(randomGenerator);
+                if (fitness[candidate] > fitness[best]) {
                     best = candidate;
                 }
             }
 
-            selectedParents.push_back(best);
+            rows.push_back(best);
         }
     }
 
     // completar seleccion si es necesario
-    while (selectedParents.size() < populationSize) {
-        selectedParents.push_back(population[popDist(randomGenerator)]);
+    while (rows.size() < populationSize) {
+        rows.push_back(popDist(randomGenerator));
     }
-
-    return selectedParents;
 }
 
 
 
 // genera la siguiente generacion mediante seleccion, cruzamiento y mutacion
+// primero se deciden todos los sorteos de los hijos y luego se escriben columna por columna en el otro almacen
 void Genetics::createNextGeneration() {
     generation++;
     mutationCount = 0;
 
     std::cout << "=== Creando Generación " << generation << " ===\n";
 
-    DynamicArray<Chromosome> parents = selectParents();
-    DynamicArray<Chromosome> newPopulation;
+    selectParentRows(parentRows);
 
     // conservar mejor cromosoma usando elitismo estricto
-    Chromosome bestChromosome = getBestChromosome();
-    newPopulation.push_back(bestChromosome);
-    std::cout << "Mejor cromosoma conservado con fitness: " << bestChromosome.getFitness() << "\n";
+    size_t bestRow = population->bestRow();
+    std::cout << "Mejor cromosoma conservado con fitness: " << population->getFitness(bestRow) << "\n";
 
     // ajustar parametros segun estado actual de la poblacion
     adaptParameters();
 
     // generar resto de la poblacion mediante reproduccion
+    size_t childCount = populationSize > 1 ? populationSize - 1 : 0;
+    if (breedingMode == BreedingMode::Batch) {
+        breedingRandom.seed(breedingStream);
+        breedingPlan.drawBatch(breedingRandom, parentRows, *population, crossoverRate, mutationRate, childCount);
+    } else {
+        planOffspring(parentRows, childCount);
+    }
+
+    nextPopulation->resize(childCount + 1);
+    nextPopulation->copyRow(0, *population, bestRow);
+    mutationCount = nextPopulation->breed(*population, breedingPlan, 1);
+
+    // reemplazar poblacion anterior con la nueva generacion
+    std::swap(population, nextPopulation);
+
+    // aplicar mecanismos de mantenimiento de diversidad si es necesario
+    if (averageDiversity < convergenceThreshold) {
+        maintainDiversity();
+    }
+
+    std::cout << "Nueva generación creada. Mutaciones: " << mutationCount
+              << "/" << populationSize << " (" << (100.0f * mutationCount / populationSize) << "%)\n";
+    std::cout << "=== Fin Generación " << generation << " ===\n";
+}
+
+
+
+// sortea padres, cruzamiento y mutacion de cada hijo en el mismo orden que el recorrido por individuo
+// asi la poblacion resultante no depende de que los genes se procesen despues por columnas
+void Genetics::planOffspring(const DynamicArray<int>& parents, size_t count) {
+    breedingPlan.resize(count); // cada hijo arranca como copia, solo se escribe lo que cambia
     std::uniform_real_distribution<float> crossoverChance(0.0f, 1.0f);
 
-    while (newPopulation.size() < populationSize) {
+    for (size_t child = 0; child < count; ++child) {
         // seleccionar dos padres diferentes para maximizar diversidad
         std::uniform_int_distribution<int> parentDist(0, parents.size() - 1);
         int parent1Index = parentDist(randomGenerator);
@@ -197,102 +247,107 @@ void Genetics::createNextGeneration() {
             attempts++;
         }
 
-        Chromosome& parent1 = parents[parent1Index];
-        Chromosome& parent2 = parents[parent2Index];
+        int parent1 = parents[parent1Index];
+        int parent2 = parents[parent2Index];
+        breedingPlan.firstParent[child] = parent1;
+        breedingPlan.secondParent[child] = parent2;
 
-        Chromosome child;
-
-        // aplicar cruzamiento segun probabilidad configurada
+        // aplicar cruzamiento segun probabilidad configurada, mismos sorteos que Chromosome::crossover
         if (crossoverChance(randomGenerator) < crossoverRate) {
-            child = parent1.crossover(parent2);
+            std::uniform_real_distribution<float> weightDist(0.2f, 0.8f);
+            std::uniform_int_distribution<int> methodDist(0, 1);
+
+            if (methodDist(chromosomeRandom) == 0) {
+                breedingPlan.weight[child] = weightDist(chromosomeRandom);
+            } else {
+                std::uniform_int_distribution<int> pointDist(1, 4);
+                breedingPlan.crossPoint[child] = static_cast<float>(pointDist(chromosomeRandom));
+            }
+            breedingPlan.fitness[child] = 0.0f;
         } else {
             // sin cruzamiento, heredar del padre con mejor fitness
-            child = (parent1.getFitness() > parent2.getFitness()) ? parent1 : parent2;
+            if (population->getFitness(parent1) <= population->getFitness(parent2)) {
+                breedingPlan.firstParent[child] = parent2;
+            }
+            breedingPlan.fitness[child] = population->getFitness(breedingPlan.firstParent[child]);
         }
 
-        // detectar y contar mutaciones comparando antes y despues
-        Chromosome originalChild = child;
-        child.mutate(mutationRate);
-
-        // verificar si ocurrio mutacion en alguna caracteristica
-        if (std::abs(child.getHealth() - originalChild.getHealth()) > 0.01f ||
-            std::abs(child.getSpeed() - originalChild.getSpeed()) > 0.01f ||
-            std::abs(child.getArrowResistance() - originalChild.getArrowResistance()) > 0.01f ||
-            std::abs(child.getArtilleryResistance() - originalChild.getArtilleryResistance()) > 0.01f ||
-            std::abs(child.getMagicResistance() - originalChild.getMagicResistance()) > 0.01f) {
-            mutationCount++;
+        // sortear la mutacion de cada gen, mismos sorteos que Chromosome::mutate
+        // las distribuciones normales se crean por hijo porque guardan un valor entre llamadas
+        float adaptiveFactor = Chromosome::mutationFactor(breedingPlan.fitness[child]);
+        std::uniform_real_distribution<float> mutationChance(0.0f, 1.0f);
+        std::normal_distribution<float> healthMut(0.0f, 40.0f * adaptiveFactor);
+        std::normal_distribution<float> speedMut(0.0f, 15.0f * adaptiveFactor);
+        std::normal_distribution<float> resMut(0.0f, 0.25f * adaptiveFactor);
+
+        for (int gene = 0; gene < GENE_COUNT; gene++) {
+            float delta = 0.0f;
+            if (mutationChance(chromosomeRandom) < mutationRate) {
+                if (gene == static_cast<int>(Gene::Health)) {
+                    delta = healthMut(chromosomeRandom);
+                } else if (gene == static_cast<int>(Gene::Speed)) {
+                    delta = speedMut(chromosomeRandom);
+                } else {
+                    delta = resMut(chromosomeRandom);
+                }
+            }
+            breedingPlan.mutation[gene][child] = delta;
         }
-
-        newPopulation.push_back(child);
-    }
-
-    // reemplazar poblacion anterior con la nueva generacion
-    population = newPopulation;
-
-    // aplicar mecanismos de mantenimiento de diversidad si es necesario
-    if (averageDiversity < convergenceThreshold) {
-        maintainDiversity();
     }
-
-    std::cout << "Nueva generación creada. Mutaciones: " << mutationCount
-              << "/" << populationSize << " (" << (100.0f * mutationCount / populationSize) << "%)\n";
-    std::cout << "=== Fin Generación " << generation << " ===\n";
 }
 
 
 
 // encuentra y retorna el cromosoma con mayor fitness
 Chromosome Genetics::getBestChromosome() const {
-    if (population.empty()) {
+    if (population->empty()) {
         return Chromosome();
     }
 
-    return *std::max_element(population.begin(), population.end(), [](const Chromosome& a, const Chromosome& b) {
-        return a.getFitness() < b.getFitness();
-    });
+    return population->get(population->bestRow());
 }
 
 
 
 // selecciona cromosomas para generar enemigos en la siguiente oleada
-DynamicArray<Chromosome> Genetics::getChromosomesForWave(int count) {
-    DynamicArray<Chromosome> waveChromosomes;
+// el resultado sale de resource si se indica, la copia ordenada de la memoria de temporales
+DynamicArray<Chromosome> Genetics::getChromosomesForWave(int count, MemoryResource* resource) {
+    DynamicArray<Chromosome> waveChromosomes(resource);
+    waveChromosomes.reserve(count);
 
     // generar cromosomas aleatorios si no hay poblacion disponible
-    if (population.empty()) {
+    if (population->empty()) {
         for (int i = 0; i < count; ++i) {
-            waveChromosomes.push_back(Chromosome());
+            waveChromosomes.push_back(Chromosome(chromosomeRandom));
         }
         return waveChromosomes;
     }
 
     // ordenar poblacion por fitness para seleccion estratificada
-    DynamicArray<Chromosome> sortedPopulation = population;
-    std::sort(sortedPopulation.begin(), sortedPopulation.end(), [](const Chromosome& a, const Chromosome& b) {
-        return a.getFitness() > b.getFitness();
-    });
+    DynamicArray<int> sortedRows(scratch);
+    population->sortedRows(sortedRows);
 
     // balancear entre elite y diversidad: 70% mejores, 30% diversos
     int eliteCount = std::max(1, static_cast<int>(count * 0.7f));
     int diverseCount = count - eliteCount;
 
     // seleccionar los cromosomas con mejor fitness
-    for (int i = 0; i < eliteCount && i < sortedPopulation.size(); ++i) {
-        waveChromosomes.push_back(sortedPopulation[i]);
+    for (int i = 0; i < eliteCount && i < sortedRows.size(); ++i) {
+        waveChromosomes.push_back(population->get(sortedRows[i]));
     }
 
     // agregar cromosomas diversos de la poblacion menos exitosa
-    if (diverseCount > 0 && sortedPopulation.size() > eliteCount) {
-        std::uniform_int_distribution<int> diverseDist(eliteCount, sortedPopulation.size() - 1);
+    if (diverseCount > 0 && sortedRows.size() > eliteCount) {
+        std::uniform_int_distribution<int> diverseDist(eliteCount, sortedRows.size() - 1);
         for (int i = 0; i < diverseCount; ++i) {
             int index = diverseDist(randomGenerator);
-            waveChromosomes.push_back(sortedPopulation[index]);
+            waveChromosomes.push_back(population->get(sortedRows[index]));
         }
     }
 
     // completar con cromosomas aleatorios si es necesario
     while (waveChromosomes.size() < count) {
-        waveChromosomes.push_back(Chromosome());
+        waveChromosomes.push_back(Chromosome(chromosomeRandom));
     }
 
     return waveChromosomes;
@@ -301,11 +356,12 @@ DynamicArray<Chromosome> Genetics::getChromosomesForWave(int count) {
 
 
 // recopila todos los valores de fitness de la poblacion actual
-DynamicArray<float> Genetics::getCurrentFitnessScores() const {
-    DynamicArray<float> scores;
+DynamicArray<float> Genetics::getCurrentFitnessScores(MemoryResource* resource) const {
+    DynamicArray<float> scores(resource);
+    scores.reserve(population->size());
 
-    for (const auto& chromosome : population) {
-        scores.push_back(chromosome.getFitness());
+    for (float fitness : population->getFitness()) {
+        scores.push_back(fitness);
     }
 
     return scores;
@@ -315,38 +371,41 @@ DynamicArray<float> Genetics::getCurrentFitnessScores() const {
 
 // calcula el fitness promedio de toda la poblacion
 float Genetics::getAverageFitness() const {
-    if (population.empty()) {
+    if (population->empty()) {
         return 0.0f;
     }
 
     float sumFitness = 0.0f;
-    for (const auto& chromosome : population) {
-        sumFitness += chromosome.getFitness();
+    for (float fitness : population->getFitness()) {
+        sumFitness += fitness;
     }
 
-    return sumFitness / population.size();
+    return sumFitness / population->size();
 }
 
 
 
 // mide la diversidad genetica promedio de la poblacion
+// es el promedio de Chromosome::calculateDiversity sobre todos los pares, calculado por columnas
+// la diferencia normalizada se separa por gen, asi basta la suma de distancias de cada columna
 float Genetics::getDiversityMetric() const {
-    if (population.size() < 2) {
+    if (population->size() < 2) {
         return 1.0f;
     }
 
-    float totalDiversity = 0.0f;
-    int comparisons = 0;
+    // mismas escalas que Chromosome::calculateDiversity
+    static const double GENE_SCALE[GENE_COUNT] = {300.0, 100.0, 2.0, 2.0, 2.0};
 
-    // calcular diversidad entre pares de cromosomas con limite de comparaciones
-    for (size_t i = 0; i < population.size(); ++i) {
-        for (size_t j = i + 1; j < population.size() && comparisons < 50; ++j) {
-            totalDiversity += population[i].calculateDiversity(population[j]);
-            comparisons++;
-        }
+    DynamicArray<float> sorted(scratch);
+    DynamicArray<float> buffer(scratch);
+    double totalDiversity = 0.0;
+    for (int gene = 0; gene < GENE_COUNT; gene++) {
+        totalDiversity += population->pairwiseDistanceSum(static_cast<Gene>(gene), sorted, buffer) / GENE_SCALE[gene];
     }
 
-    return comparisons > 0 ? totalDiversity / comparisons : 1.0f;
+    double count = static_cast<double>(population->size());
+    double pairs = count * (count - 1.0) / 2.0;
+    return static_cast<float>(totalDiversity / GENE_COUNT / pairs);
 }
 
 
@@ -386,19 +445,15 @@ void Genetics::adaptParameters() {
 // introduce nuevos individuos aleatorios para mantener diversidad genetica
 void Genetics::maintainDiversity() {
     int newIndividuals = populationSize * 0.2f; // reemplazar 20% de la poblacion
-    std::uniform_int_distribution<int> popDist(0, population.size() - 1);
-
     std::cout << "Manteniendo diversidad: introduciendo " << newIndividuals << " nuevos individuos\n";
 
     // ordenar poblacion por fitness para reemplazar a los peores
-    std::sort(population.begin(), population.end(), [](const Chromosome& a, const Chromosome& b) {
-        return a.getFitness() > b.getFitness();
-    });
+    sortPopulationByFitness();
 
     // sustituir los peores individuos con cromosomas completamente nuevos
-    for (int i = 0; i < newIndividuals && i < population.size(); ++i) {
-        int replaceIndex = population.size() - 1 - i;
-        population[replaceIndex] = Chromosome(); // generar cromosoma aleatorio
+    for (int i = 0; i < newIndividuals && i < population->size(); ++i) {
+        int replaceIndex = population->size() - 1 - i;
+        population->set(replaceIndex, Chromosome(chromosomeRandom)); // generar cromosoma aleatorio
     }
 }
 
@@ -426,13 +481,11 @@ void Genetics::resetPopulationIfStagnant() {
                   << " generaciones. Reseteando 50% de la población.\n";
 
         // conservar solo la mitad superior de la poblacion
-        std::sort(population.begin(), population.end(), [](const Chromosome& a, const Chromosome& b) {
-            return a.getFitness() > b.getFitness();
-        });
+        sortPopulationByFitness();
 
-        int keepCount = population.size() / 2;
-        for (size_t i = keepCount; i < population.size(); ++i) {
-            population[i] = Chromosome(); // reemplazar con cromosomas frescos
+        int keepCount = population->size() / 2;
+        for (size_t i = keepCount; i < population->size(); ++i) {
+            population->set(i, Chromosome(chromosomeRandom)); // reemplazar con cromosomas frescos
         }
 
         stagnantGenerations = 0;
@@ -468,4 +521,38 @@ float Genetics::getMutationRate() const {
 void Genetics::setPathTotalLength(float length) {
     pathTotalLength = length;
     std::cout << "Longitud total del camino establecida: " << length << "\n";
-}
\ No newline at end of file
+}
+
+
+
+// reordena la poblacion de mayor a menor fitness copiando las filas al otro almacen
+void Genetics::sortPopulationByFitness() {
+    population->sortedRows(orderRows);
+
+    nextPopulation->resize(population->size());
+    for (size_t i = 0; i < orderRows.size(); ++i) {
+        nextPopulation->copyRow(i, *population, orderRows[i]);
+    }
+    std::swap(population, nextPopulation);
+}
+
+
+
+// asigna la memoria de temporales de cada generacion, por ejemplo la arena del paso de simulacion
+void Genetics::setScratchMemory(MemoryResource* resource) {
+    scratch = resource;
+}
+
+
+
+// elige como la ruleta reparte a los padres cuando hay diversidad suficiente
+void Genetics::setSelectionStrategy(SelectionStrategy strategy) {
+    selectionStrategy = strategy;
+}
+
+
+
+// elige como se sortean los hijos, Sequential reproduce las corridas anteriores a los kernels por carriles
+void Genetics::setBreedingMode(BreedingMode mode) {
+    breedingMode = mode;
+}
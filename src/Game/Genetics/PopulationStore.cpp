@@ -0,0 +1,430 @@
+#include "../include/Game/Genetics/PopulationStore.h"
+#include "../include/DataStructures/SimdLanes.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// limites de cada gen, los mismos que aplica Chromosome::clampValues
+static const float GENE_MIN[GENE_COUNT] = {50.0f, 20.0f, 0.0f, 0.0f, 0.0f};
+static const float GENE_MAX[GENE_COUNT] = {350.0f, 120.0f, 2.5f, 2.5f, 2.5f};
+
+// desviacion de la mutacion de cada gen antes del factor adaptativo, la misma de Chromosome::mutate
+static const float MUTATION_SIGMA[GENE_COUNT] = {40.0f, 15.0f, 0.25f, 0.25f, 0.25f};
+
+
+
+// prepara el plan para childCount hijos, las columnas quedan con el relleno de carriles
+// todos los hijos arrancan neutros: copia de la fila 0 sin mutacion
+void BreedingPlan::resize(size_t childCount) {
+    count = childCount;
+    size_t padded = lanePadded(childCount);
+
+    firstParent.resize(padded);
+    secondParent.resize(padded);
+    weight.resize(padded);
+    crossPoint.resize(padded);
+    fitness.resize(padded);
+    std::fill(firstParent.begin(), firstParent.end(), 0);
+    std::fill(secondParent.begin(), secondParent.end(), 0);
+    std::fill(weight.begin(), weight.end(), 1.0f);
+    std::fill(crossPoint.begin(), crossPoint.end(), 0.0f);
+    std::fill(fitness.begin(), fitness.end(), 0.0f);
+
+    for (auto& column : mutation) {
+        column.resize(padded);
+        std::fill(column.begin(), column.end(), 0.0f);
+    }
+}
+
+
+
+// sortea los hijos de a SIMD_LANES con un generador por carril, sin distribuciones ni ramas por gen
+// mismas probabilidades que Genetics::planOffspring salvo dos cambios para no depender de rechazos ni de estado:
+// el segundo padre se elige entre los demas padres en lugar de reintentar, y el ruido normal
+// es la suma de cuatro uniformes centrada y escalada a desviacion 1 (Irwin-Hall), acotada a +-3.46
+void BreedingPlan::drawBatch(LaneRandom& random, const DynamicArray<int>& parents, const PopulationStore& population,
+                             float crossoverRate, float mutationRate, size_t childCount) {
+    resize(childCount);
+
+    // copias locales: las escrituras por carriles pueden apuntar a cualquier cosa para el compilador
+    // y con el estado o los punteros en miembros los volveria a leer despues de cada escritura
+    LaneRandom lanes = random;
+    int* firstRows = firstParent.begin();
+    int* secondRows = secondParent.begin();
+    float* weights = weight.begin();
+    float* cuts = crossPoint.begin();
+    float* childFitness = fitness.begin();
+    float* deltas[GENE_COUNT];
+    for (int gene = 0; gene < GENE_COUNT; gene++) {
+        deltas[gene] = mutation[gene].begin();
+    }
+
+    int parentCount = static_cast<int>(parents.size());
+    if (parentCount == 0) return;
+
+    const FloatLanes zero = FloatLanes::fill(0.0f);
+    const FloatLanes one = FloatLanes::fill(1.0f);
+    const UintLanes lowHalf = UintLanes::fill(0xFFFFu);
+    const FloatLanes halfScale = FloatLanes::fill(1.0f / 65536.0f);
+    const FloatLanes center = FloatLanes::fill(2.0f);          // media de la suma de cuatro uniformes
+    const FloatLanes unitScale = FloatLanes::fill(1.7320508f); // raiz de 3
+    const FloatLanes crossRate = FloatLanes::fill(crossoverRate);
+    const FloatLanes rate = FloatLanes::fill(mutationRate);
+
+    // los carriles de relleno tambien se sortean, escriben solo en el relleno de las columnas
+    for (size_t block = 0; block < childCount; block += SIMD_LANES) {
+        float firstPick[SIMD_LANES], secondPick[SIMD_LANES], crossoverRoll[SIMD_LANES], inherited[SIMD_LANES];
+        lanes.nextUnit().store(firstPick);
+        lanes.nextUnit().store(secondPick);
+        FloatLanes crossRoll = lanes.nextUnit();
+        FloatLanes methodRoll = lanes.nextUnit();
+        FloatLanes shapeRoll = lanes.nextUnit();
+        crossRoll.store(crossoverRoll);
+
+        // padres, el segundo se elige entre los demas para que siempre sean distintos
+        // sin cruzamiento se hereda del padre con mejor fitness
+        for (int lane = 0; lane < SIMD_LANES; ++lane) {
+            size_t child = block + lane;
+            int index1 = std::min(static_cast<int>(firstPick[lane] * parentCount), parentCount - 1);
+            int index2 = index1;
+            if (parentCount > 1) {
+                int offset = std::min(static_cast<int>(secondPick[lane] * (parentCount - 1)), parentCount - 2);
+                index2 = index1 + 1 + offset;
+                if (index2 >= parentCount) index2 -= parentCount;
+            }
+
+            int parent1 = parents[index1];
+            int parent2 = parents[index2];
+            float fitness1 = population.getFitness(parent1);
+            float fitness2 = population.getFitness(parent2);
+            bool inheritSecond = !(crossoverRoll[lane] < crossoverRate) && fitness1 <= fitness2;
+            firstRows[child] = inheritSecond ? parent2 : parent1;
+            secondRows[child] = parent2;
+            inherited[lane] = inheritSecond ? fitness2 : fitness1;
+        }
+
+        // forma de cruce: el mismo sorteo da el peso del aritmetico o el punto de corte de 1 a 4
+        MaskLanes crosses = lanesLess(crossRoll, crossRate);
+        MaskLanes arithmetic = lanesLess(methodRoll, FloatLanes::fill(0.5f));
+        FloatLanes blend = FloatLanes::fill(0.2f) + FloatLanes::fill(0.6f) * shapeRoll;
+        FloatLanes point = one + lanesSelect(lanesLess(shapeRoll, FloatLanes::fill(0.25f)), zero, one)
+                               + lanesSelect(lanesLess(shapeRoll, FloatLanes::fill(0.5f)), zero, one)
+                               + lanesSelect(lanesLess(shapeRoll, FloatLanes::fill(0.75f)), zero, one);
+        lanesSelect(crosses, lanesSelect(arithmetic, blend, one), one).store(weights + block);
+        lanesSelect(crosses, lanesSelect(arithmetic, zero, point), zero).store(cuts + block);
+
+        // los hijos cruzados nacen sin fitness, los copiados con el del padre
+        FloatLanes born = lanesSelect(crosses, zero, FloatLanes::load(inherited));
+        born.store(childFitness + block);
+
+        // mismo factor que Chromosome::mutationFactor
+        FloatLanes scale = lanesSelect(lanesLess(born, FloatLanes::fill(100.0f)), FloatLanes::fill(2.0f),
+                                       lanesSelect(lanesLess(born, FloatLanes::fill(300.0f)), FloatLanes::fill(1.2f), FloatLanes::fill(0.8f)));
+
+        // mutacion de los ocho hijos a la vez, gen por gen
+        // las cuatro uniformes del ruido son las mitades de 16 bits de dos numeros, sumadas como enteros
+        for (int gene = 0; gene < GENE_COUNT; gene++) {
+            FloatLanes roll = lanes.nextUnit();
+            UintLanes first = lanes.next();
+            UintLanes second = lanes.next();
+            UintLanes halves = shiftRight<16>(first) + (first & lowHalf) + shiftRight<16>(second) + (second & lowHalf);
+
+            FloatLanes sum = halves.toFloat() * halfScale;
+            FloatLanes normal = (sum - center) * unitScale;
+            FloatLanes delta = normal * FloatLanes::fill(MUTATION_SIGMA[gene]) * scale;
+            lanesSelect(lanesLess(roll, rate), delta, zero).store(deltas[gene] + block);
+        }
+    }
+
+    random = lanes;
+}
+
+
+
+// vacia todas las columnas, conserva la capacidad
+void PopulationStore::clear() {
+    for (auto& column : genes) {
+        column.clear();
+    }
+    fitness.clear();
+}
+
+
+
+// ajusta la cantidad de filas, las nuevas quedan sin inicializar
+void PopulationStore::resize(size_t count) {
+    for (auto& column : genes) {
+        column.resize(count);
+    }
+    fitness.resize(count);
+}
+
+
+
+// agrega un individuo al final
+void PopulationStore::push_back(const Chromosome& chromosome) {
+    genes[static_cast<int>(Gene::Health)].push_back(chromosome.getHealth());
+    genes[static_cast<int>(Gene::Speed)].push_back(chromosome.getSpeed());
+    genes[static_cast<int>(Gene::ArrowResistance)].push_back(chromosome.getArrowResistance());
+    genes[static_cast<int>(Gene::MagicResistance)].push_back(chromosome.getMagicResistance());
+    genes[static_cast<int>(Gene::ArtilleryResistance)].push_back(chromosome.getArtilleryResistance());
+    fitness.push_back(chromosome.getFitness());
+}
+
+
+
+// arma el cromosoma de una fila, los genes guardados ya estan dentro de sus rangos
+Chromosome PopulationStore::get(size_t row) const {
+    Chromosome chromosome(genes[static_cast<int>(Gene::Health)][row],
+                          genes[static_cast<int>(Gene::Speed)][row],
+                          genes[static_cast<int>(Gene::ArrowResistance)][row],
+                          genes[static_cast<int>(Gene::MagicResistance)][row],
+                          genes[static_cast<int>(Gene::ArtilleryResistance)][row]);
+    chromosome.setFitness(fitness[row]);
+    return chromosome;
+}
+
+
+
+// reemplaza el individuo de una fila
+void PopulationStore::set(size_t row, const Chromosome& chromosome) {
+    genes[static_cast<int>(Gene::Health)][row] = chromosome.getHealth();
+    genes[static_cast<int>(Gene::Speed)][row] = chromosome.getSpeed();
+    genes[static_cast<int>(Gene::ArrowResistance)][row] = chromosome.getArrowResistance();
+    genes[static_cast<int>(Gene::MagicResistance)][row] = chromosome.getMagicResistance();
+    genes[static_cast<int>(Gene::ArtilleryResistance)][row] = chromosome.getArtilleryResistance();
+    fitness[row] = chromosome.getFitness();
+}
+
+
+
+// copia una fila de otra poblacion
+void PopulationStore::copyRow(size_t row, const PopulationStore& from, size_t fromRow) {
+    for (int gene = 0; gene < GENE_COUNT; gene++) {
+        genes[gene][row] = from.genes[gene][fromRow];
+    }
+    fitness[row] = from.fitness[fromRow];
+}
+
+
+
+// ordena indices en lugar de individuos, std::sort hace las mismas comparaciones
+// asi los empates quedan igual que al ordenar los cromosomas
+void PopulationStore::sortedRows(DynamicArray<int>& rows) const {
+    rows.resize(size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        rows[i] = static_cast<int>(i);
+    }
+
+    const DynamicArray<float>& scores = fitness;
+    std::sort(rows.begin(), rows.end(), [&scores](int a, int b) {
+        return scores[a] > scores[b];
+    });
+}
+
+
+
+// nth_element deja las mejores count filas al frente y solo esas se ordenan
+void PopulationStore::topRows(DynamicArray<int>& rows, size_t count) const {
+    rows.resize(size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        rows[i] = static_cast<int>(i);
+    }
+
+    count = std::min(count, rows.size());
+    const DynamicArray<float>& scores = fitness;
+    auto better = [&scores](int a, int b) {
+        if (scores[a] != scores[b]) return scores[a] > scores[b];
+        return a < b;
+    };
+
+    if (count < rows.size()) {
+        std::nth_element(rows.begin(), rows.begin() + count, rows.end(), better);
+    }
+    std::sort(rows.begin(), rows.begin() + count, better);
+    rows.resize(count);
+}
+
+
+
+// clave entera con el mismo orden que el float: a los positivos se les prende el signo y los negativos se invierten
+static inline uint32_t orderedKey(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+
+
+// ordena column en sorted por radix lsd de tres digitos de 11 bits, O(n) sin comparaciones
+// buffer es la memoria de ida y vuelta entre pasadas, con pocos valores std::sort es mas barato
+static void sortColumn(const DynamicArray<float>& column, DynamicArray<float>& sorted, DynamicArray<float>& buffer) {
+    const size_t RADIX_MIN = 512;
+    const int DIGIT_BITS = 11;
+    const uint32_t DIGIT_MASK = (1u << DIGIT_BITS) - 1;
+    size_t count = column.size();
+
+    sorted.resize(count);
+    if (count < RADIX_MIN) {
+        std::copy(column.begin(), column.end(), sorted.begin());
+        std::sort(sorted.begin(), sorted.end());
+        return;
+    }
+
+    // los tres histogramas en una sola lectura
+    uint32_t offsets[3][1u << DIGIT_BITS] = {};
+    for (float value : column) {
+        uint32_t key = orderedKey(value);
+        offsets[0][key & DIGIT_MASK]++;
+        offsets[1][(key >> DIGIT_BITS) & DIGIT_MASK]++;
+        offsets[2][key >> (2 * DIGIT_BITS)]++;
+    }
+    for (auto& digit : offsets) {
+        uint32_t start = 0;
+        for (uint32_t& slot : digit) {
+            uint32_t amount = slot;
+            slot = start;
+            start += amount;
+        }
+    }
+
+    // tres pasadas estables: column -> sorted -> buffer -> sorted
+    buffer.resize(count);
+    const float* source[3] = {column.begin(), sorted.begin(), buffer.begin()};
+    float* target[3] = {sorted.begin(), buffer.begin(), sorted.begin()};
+    for (int digit = 0; digit < 3; digit++) {
+        uint32_t* slots = offsets[digit];
+        int shift = digit * DIGIT_BITS;
+        for (size_t i = 0; i < count; i++) {
+            float value = source[digit][i];
+            target[digit][slots[(orderedKey(value) >> shift) & DIGIT_MASK]++] = value;
+        }
+    }
+}
+
+
+
+// con la columna ordenada cada hueco entre valores vecinos k y k + 1 lo cruzan (k + 1) * (n - k - 1) pares
+// la suma de huecos por pares no tiene restas entre terminos grandes, asi no se pierde precision
+// los carriles acumulan en float por tramos cortos y cada tramo se suma en double
+double PopulationStore::pairwiseDistanceSum(Gene gene, DynamicArray<float>& sorted, DynamicArray<float>& buffer) const {
+    const DynamicArray<float>& column = genes[static_cast<int>(gene)];
+    size_t count = column.size();
+    if (count < 2) return 0.0;
+
+    sortColumn(column, sorted, buffer);
+
+    const size_t gaps = count - 1;
+    const size_t chunk = 64 * SIMD_LANES;
+    static const float laneOffset[SIMD_LANES] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+    const FloatLanes ramp = FloatLanes::load(laneOffset);
+    const FloatLanes total = FloatLanes::fill(static_cast<float>(count));
+    const float* values = sorted.begin();
+    double sum = 0.0;
+    size_t k = 0;
+
+    while (k + SIMD_LANES <= gaps) {
+        size_t end = k + std::min(chunk, (gaps - k) / SIMD_LANES * SIMD_LANES);
+        FloatLanes partial = FloatLanes::fill(0.0f);
+
+        for (; k < end; k += SIMD_LANES) {
+            FloatLanes gap = FloatLanes::load(values + k + 1) - FloatLanes::load(values + k);
+            FloatLanes below = FloatLanes::fill(static_cast<float>(k)) + ramp;
+            partial = partial + gap * (below * (total - below));
+        }
+
+        float lanes[SIMD_LANES];
+        partial.store(lanes);
+        for (float value : lanes) {
+            sum += value;
+        }
+    }
+
+    for (; k < gaps; k++) {
+        double below = static_cast<double>(k + 1);
+        sum += static_cast<double>(values[k + 1] - values[k]) * below * (count - below);
+    }
+
+    return sum;
+}
+
+
+
+// busca el mayor fitness
+size_t PopulationStore::bestRow() const {
+    size_t best = 0;
+    for (size_t i = 1; i < fitness.size(); i++) {
+        if (fitness[i] > fitness[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+
+
+// aplica el plan de a SIMD_LANES hijos, cada gen se cruza, se limita y se muta sin ramas por hijo
+// mismas operaciones y en el mismo orden que Chromosome::crossover y Chromosome::mutate, sin fma
+// asi el resultado es el mismo con AVX2, SSE2 o la version escalar
+int PopulationStore::breed(const PopulationStore& parents, const BreedingPlan& plan, size_t first) {
+    size_t count = plan.size();
+    int mutatedCount = 0;
+    const FloatLanes one = FloatLanes::fill(1.0f);
+    const FloatLanes threshold = FloatLanes::fill(0.01f);
+
+    // punteros en locales, las escrituras por carriles obligarian a releerlos de los miembros
+    const int* firstRows = plan.firstParent.begin();
+    const int* secondRows = plan.secondParent.begin();
+    const float* weights = plan.weight.begin();
+    const float* cuts = plan.crossPoint.begin();
+    const float* source[GENE_COUNT];
+    const float* deltas[GENE_COUNT];
+    float* target[GENE_COUNT];
+    for (int gene = 0; gene < GENE_COUNT; gene++) {
+        source[gene] = parents.genes[gene].begin();
+        deltas[gene] = plan.mutation[gene].begin();
+        target[gene] = genes[gene].begin() + first;
+    }
+
+    for (size_t block = 0; block < count; block += SIMD_LANES) {
+        size_t lanes = std::min(count - block, static_cast<size_t>(SIMD_LANES));
+        FloatLanes w1 = FloatLanes::load(weights + block);
+        FloatLanes w2 = one - w1;
+        FloatLanes cut = FloatLanes::load(cuts + block);
+        MaskLanes changed = lanesLess(one, one);    // ningun carril activo
+
+        for (int gene = 0; gene < GENE_COUNT; gene++) {
+            FloatLanes low = FloatLanes::fill(GENE_MIN[gene]);
+            FloatLanes high = FloatLanes::fill(GENE_MAX[gene]);
+            FloatLanes a = FloatLanes::gather(source[gene], firstRows + block);
+            FloatLanes b = FloatLanes::gather(source[gene], secondRows + block);
+
+            // cruzamiento, los genes antes del punto de corte vienen del segundo padre
+            FloatLanes mixed = lanesMin(lanesMax(a * w1 + b * w2, low), high);
+            FloatLanes value = lanesSelect(lanesLess(FloatLanes::fill(static_cast<float>(gene)), cut), b, mixed);
+
+            // mutacion, un cambio cero deja el gen igual porque ya esta dentro de su rango
+            FloatLanes delta = FloatLanes::load(deltas[gene] + block);
+            FloatLanes mutatedValue = lanesMin(lanesMax(value + delta, low), high);
+            changed = changed | lanesLess(threshold, lanesAbs(mutatedValue - value));
+
+            // los bloques completos se escriben directo, el ultimo pasa por un buffer
+            if (lanes == SIMD_LANES) {
+                mutatedValue.store(target[gene] + block);
+            } else {
+                float tail[SIMD_LANES];
+                mutatedValue.store(tail);
+                std::copy(tail, tail + lanes, target[gene] + block);
+            }
+        }
+
+        // los carriles de relleno no cuentan
+        int bits = lanesBits(changed) & ((1 << lanes) - 1);
+        for (; bits != 0; bits &= bits - 1) {
+            mutatedCount++;
+        }
+    }
+
+    std::copy(plan.fitness.begin(), plan.fitness.begin() + count, fitness.begin() + first);
+    return mutatedCount;
+}
@@ -0,0 +1,96 @@
+#include "../include/Game/Genetics/RouletteTable.h"
+#include <algorithm>
+
+// sumas acumuladas en float en el orden de las filas, como el recorrido original de la ruleta
+// la tabla de alias se arma con el metodo de Vose, en O(n)
+void RouletteTable::build(const DynamicArray<float>& fitness) {
+    size_t count = fitness.size();
+    cumulative.resize(count);
+    keep.resize(count);
+    alias.resize(count);
+
+    float sum = 0.0f;
+    for (size_t row = 0; row < count; ++row) {
+        sum += std::max(MIN_WEIGHT, fitness[row]);
+        cumulative[row] = sum;
+    }
+    if (count == 0) return;
+
+    // cada columna arranca con su peso escalado a promedio 1
+    smallColumns.clear();
+    largeColumns.clear();
+    double doubleTotal = 0.0;
+    for (size_t row = 0; row < count; ++row) {
+        doubleTotal += std::max(MIN_WEIGHT, fitness[row]);
+    }
+    double scale = static_cast<double>(count) / doubleTotal;
+    for (size_t row = 0; row < count; ++row) {
+        keep[row] = static_cast<float>(std::max(MIN_WEIGHT, fitness[row]) * scale);
+        alias[row] = static_cast<int>(row);
+        if (keep[row] < 1.0f) {
+            smallColumns.push_back(static_cast<int>(row));
+        } else {
+            largeColumns.push_back(static_cast<int>(row));
+        }
+    }
+
+    // cada columna chica se completa con masa de una grande
+    while (!smallColumns.empty() && !largeColumns.empty()) {
+        int small = smallColumns.back();
+        smallColumns.pop_back();
+        int large = largeColumns.back();
+
+        alias[small] = large;
+        keep[large] = (keep[large] + keep[small]) - 1.0f;
+        if (keep[large] < 1.0f) {
+            largeColumns.pop_back();
+            smallColumns.push_back(large);
+        }
+    }
+
+    // lo que queda esta lleno salvo error de redondeo
+    for (int row : smallColumns) {
+        keep[row] = 1.0f;
+    }
+    for (int row : largeColumns) {
+        keep[row] = 1.0f;
+    }
+}
+
+
+
+// primera suma acumulada mayor o igual a value, las sumas crecen asi que alcanza con busqueda binaria
+int RouletteTable::spin(float value) const {
+    const float* found = std::lower_bound(cumulative.begin(), cumulative.end(), value);
+    if (found == cumulative.end()) {
+        return -1;
+    }
+    return static_cast<int>(found - cumulative.begin());
+}
+
+
+
+// una columna uniforme y un real para decidir entre la columna y su alias
+int RouletteTable::drawAlias(RandomStream& random) const {
+    int column = random.rangeInt(0, static_cast<int>(size()) - 1);
+    return random.nextFloat() < keep[column] ? column : alias[column];
+}
+
+
+
+// los punteros avanzan en un solo recorrido de las sumas acumuladas, O(n + count)
+void RouletteTable::universal(RandomStream& random, int count, DynamicArray<int>& rows) const {
+    if (count <= 0 || empty()) return;
+
+    double step = static_cast<double>(total()) / count;
+    double start = random.nextFloat() * step;
+    size_t row = 0;
+
+    for (int i = 0; i < count; ++i) {
+        double pointer = start + i * step;
+        while (row + 1 < size() && cumulative[row] < pointer) {
+            ++row;
+        }
+        rows.push_back(static_cast<int>(row));
+    }
+}
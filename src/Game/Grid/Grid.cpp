@@ -5,10 +5,7 @@
 
 // constructor de la cuadrícula
 Grid::Grid(float x, float y, int rows, int cols, float cellSize)
-    : x(x), y(y), rows(rows), cols(cols), cellSize(cellSize), texturesLoaded(false) {
-
-    // cargar texturas del suelo
-    loadBackgroundTextures();
+    : x(x), y(y), rows(rows), cols(cols), cellSize(cellSize) {
 
     // inicializar la matriz de celdas
     cells.resize(rows);
@@ -16,49 +13,13 @@ Grid::Grid(float x, float y, int rows, int cols, float cellSize)
         cells[i].reserve(cols);
         for (int j = 0; j < cols; j++) {
             cells[i].emplace_back(x + j * cellSize, y + i * cellSize, cellSize);
-
-            // aplicar texturas
-            if (texturesLoaded) {
-                bool useTexture1 = (i + j) % 2 == 0;
-
-                if (useTexture1) {
-                    cells[i][j].setBackgroundTexture(&groundTexture1);
-                } else {
-                    cells[i][j].setBackgroundTexture(&groundTexture2);
-                }
-            }
         }
     }
-}
-
-
-
-// metodo para cargar las texturas del suelo
-bool Grid::loadBackgroundTextures() {
-    bool success = true;
-
-    if (!groundTexture1.loadFromFile("assets/images/grid/suelo1.png")) {
-        std::cerr << "error: no se pudo cargar suelo1.png" << std::endl;
-        success = false;
-    }
 
-    if (!groundTexture2.loadFromFile("assets/images/grid/suelo2.png")) {
-        std::cerr << "error: no se pudo cargar suelo2.png" << std::endl;
-        success = false;
-    }
-
-    texturesLoaded = success;
-    return success;
-}
-
-
-
-// dibuja la cuadrícula en la ventana
-void Grid::draw(sf::RenderWindow& window) {
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            cells[i][j].draw(window);
-        }
+    // todas las celdas empiezan libres
+    blockedBits.resize((static_cast<size_t>(rows) * cols + 63) / 64);
+    for (uint64_t& word : blockedBits) {
+        word = 0;
     }
 }
 
@@ -95,4 +56,72 @@ Cell* Grid::getCellAt(int row, int col) {
         return &cells[row][col];
     }
     return nullptr;
-}
\ No newline at end of file
+}
+
+
+
+// coloca o quita una torre actualizando el bit de la celda
+void Grid::placeTower(int row, int col, std::shared_ptr<Tower> tower) {
+    Cell* cell = getCellAt(row, col);
+    if (!cell) return;
+
+    size_t bit = static_cast<size_t>(row) * cols + col;
+    if (tower) {
+        blockedBits[bit >> 6] |= uint64_t(1) << (bit & 63);
+    } else {
+        blockedBits[bit >> 6] &= ~(uint64_t(1) << (bit & 63));
+    }
+    cell->placeTower(tower);
+    updateTowerRegistry(row, col, cell, tower);
+}
+
+
+
+// mantiene el registro en el mismo orden que el recorrido por filas de la cuadricula
+void Grid::updateTowerRegistry(int row, int col, Cell* cell, const std::shared_ptr<Tower>& tower) {
+    // busqueda binaria de la primera torre que no va antes de la celda
+    int key = row * cols + col;
+    size_t slot = 0;
+    size_t end = towers.size();
+    while (slot < end) {
+        size_t middle = (slot + end) / 2;
+        if (towers[middle].row * cols + towers[middle].col < key) {
+            slot = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+    bool occupied = slot < towers.size() && towers[slot].row == row && towers[slot].col == col;
+
+    if (!tower) {
+        if (occupied) towers.erase(slot);
+        return;
+    }
+    if (occupied) {
+        towers[slot].tower = tower;
+        return;
+    }
+
+    // insertar al final y desplazar hasta su posicion
+    towers.emplace_back(row, col, cell, tower);
+    for (size_t i = towers.size() - 1; i > slot; i--) {
+        std::swap(towers[i], towers[i - 1]);
+    }
+}
+
+
+
+void Grid::placeTower(Cell* cell, std::shared_ptr<Tower> tower) {
+    auto [row, col] = getCellCoordinates(cell);
+    placeTower(row, col, tower);
+}
+
+
+
+// calcula fila y columna de una celda a partir de su posicion
+std::pair<int, int> Grid::getCellCoordinates(const Cell* cell) const {
+    if (!cell) return {-1, -1};
+    int col = static_cast<int>((cell->getPosition().x - x) / cellSize + 0.5f);
+    int row = static_cast<int>((cell->getPosition().y - y) / cellSize + 0.5f);
+    return {row, col};
+}
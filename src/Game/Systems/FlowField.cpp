@@ -0,0 +1,363 @@
+#include "../include/Game/Systems/FlowField.h"
+#include "../include/Game/Systems/Pathfinding.h"
+#include "../include/Game/Grid/Grid.h"
+#include "../include/Game/Grid/Cell.h"
+#include <queue>
+#include <vector>
+#include <functional>
+
+// 4 direcciones: arriba, derecha, abajo, izquierda (mismo orden que a*)
+static const int DIR_ROW[] = {-1, 0, 1, 0};
+static const int DIR_COL[] = {0, 1, 0, -1};
+
+// estados de una celda durante la reparacion incremental
+static const unsigned char MARK_NONE = 0;
+static const unsigned char MARK_CANDIDATE = 1;
+static const unsigned char MARK_INVALID = 2;
+
+
+
+FlowField::FlowField()
+    :   grid(nullptr), rows(0), cols(0), goalRow(0), goalCol(0),
+        requestedGoalRow(0), requestedGoalCol(0) {
+}
+
+
+
+// una celda es transitable si esta dentro del grid y no tiene torre
+bool FlowField::isWalkable(int row, int col) const {
+    return grid->isWalkable(row, col);
+}
+
+
+
+// calcula la distancia en pasos de cada celda al objetivo con una busqueda en anchura
+void FlowField::compute(Grid* targetGrid, const sf::Vector2f& goal) {
+    grid = targetGrid;
+    worldGoal = goal;
+    rows = grid->getRows();
+    cols = grid->getCols();
+
+    distances.resize(rows * cols);
+    for (int& distance : distances) {
+        distance = UNREACHABLE;
+    }
+
+    marks.resize(rows * cols);
+    for (unsigned char& value : marks) {
+        value = MARK_NONE;
+    }
+    queue.resize(rows * cols);
+
+    auto [row, col] = Pathfinding::worldToGrid(worldGoal, grid);
+    requestedGoalRow = row;
+    requestedGoalCol = col;
+    goalRow = row;
+    goalCol = col;
+
+    // si el objetivo esta bloqueado usar una celda vecina transitable, igual que a*
+    if (!isWalkable(goalRow, goalCol)) {
+        bool found = false;
+        for (int r = -1; r <= 1 && !found; ++r) {
+            for (int c = -1; c <= 1 && !found; ++c) {
+                if (isWalkable(goalRow + r, goalCol + c)) {
+                    goalRow += r;
+                    goalCol += c;
+                    found = true;
+                }
+            }
+        }
+        if (!found) return;
+    }
+
+    // bfs desde el objetivo, todas las celdas tienen el mismo costo
+    size_t head = 0;
+    size_t tail = 0;
+    distances[index(goalRow, goalCol)] = 0;
+    queue[tail++] = index(goalRow, goalCol);
+
+    while (head < tail) {
+        int current = queue[head++];
+        int currentRow = current / cols;
+        int currentCol = current % cols;
+        int nextDistance = distances[current] + 1;
+
+        for (int i = 0; i < 4; ++i) {
+            int neighborRow = currentRow + DIR_ROW[i];
+            int neighborCol = currentCol + DIR_COL[i];
+            if (!isWalkable(neighborRow, neighborCol)) continue;
+
+            int neighbor = index(neighborRow, neighborCol);
+            if (distances[neighbor] != UNREACHABLE) continue;
+
+            distances[neighbor] = nextDistance;
+            queue[tail++] = neighbor;
+        }
+    }
+}
+
+
+
+// menor distancia entre las vecinas transitables, o UNREACHABLE si ninguna tiene camino
+int FlowField::bestNeighborDistance(int row, int col) const {
+    int best = UNREACHABLE;
+    for (int i = 0; i < 4; ++i) {
+        int neighborDistance = getDistance(row + DIR_ROW[i], col + DIR_COL[i]);
+        if (neighborDistance != UNREACHABLE && (best == UNREACHABLE || neighborDistance < best)) {
+            best = neighborDistance;
+        }
+    }
+    return best;
+}
+
+
+
+// marca una celda y la recuerda para limpiarla al terminar
+void FlowField::mark(int cell, unsigned char value) {
+    if (marks[cell] == MARK_NONE) {
+        touched.push_back(cell);
+    }
+    marks[cell] = value;
+}
+
+
+
+// limpia solo las celdas marcadas durante la ultima reparacion
+void FlowField::clearMarks() {
+    for (int cell : touched) {
+        marks[cell] = MARK_NONE;
+    }
+    touched.clear();
+}
+
+
+
+// una celda se bloqueo: invalidar las celdas cuyo camino pasaba por ella y recalcular solo esas
+void FlowField::blockCell(int row, int col) {
+    if (!grid) return;
+
+    // si cambia el objetivo la reparacion no aplica, recalcular todo
+    if ((row == goalRow && col == goalCol) || (row == requestedGoalRow && col == requestedGoalCol)) {
+        compute(grid, worldGoal);
+        return;
+    }
+
+    int blockedDistance = getDistance(row, col);
+    if (blockedDistance == UNREACHABLE) {
+        return; // ninguna celda dependia de ella
+    }
+    distances[index(row, col)] = UNREACHABLE;
+
+    // fase 1: recorrer en orden de distancia las celdas que podian depender de la bloqueada
+    // una celda conserva su distancia si aun tiene una vecina valida a distancia d - 1
+    size_t head = 0;
+    size_t tail = 0;
+    for (int i = 0; i < 4; ++i) {
+        int neighborRow = row + DIR_ROW[i];
+        int neighborCol = col + DIR_COL[i];
+        if (getDistance(neighborRow, neighborCol) == blockedDistance + 1) {
+            int neighbor = index(neighborRow, neighborCol);
+            mark(neighbor, MARK_CANDIDATE);
+            queue[tail++] = neighbor;
+        }
+    }
+
+    invalidated.clear();
+    while (head < tail) {
+        int current = queue[head++];
+        int currentRow = current / cols;
+        int currentCol = current % cols;
+        int currentDistance = distances[current];
+
+        bool supported = false;
+        for (int i = 0; i < 4 && !supported; ++i) {
+            supported = getDistance(currentRow + DIR_ROW[i], currentCol + DIR_COL[i]) == currentDistance - 1;
+        }
+        if (supported) continue;
+
+        distances[current] = UNREACHABLE;
+        mark(current, MARK_INVALID);
+        invalidated.push_back(current);
+
+        for (int i = 0; i < 4; ++i) {
+            int neighborRow = currentRow + DIR_ROW[i];
+            int neighborCol = currentCol + DIR_COL[i];
+            if (getDistance(neighborRow, neighborCol) != currentDistance + 1) continue;
+
+            int neighbor = index(neighborRow, neighborCol);
+            if (marks[neighbor] != MARK_NONE) continue;
+            mark(neighbor, MARK_CANDIDATE);
+            queue[tail++] = neighbor;
+        }
+    }
+
+    // fase 2: dijkstra limitado a la region invalidada, sembrado desde su borde valido
+    using Entry = std::pair<int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> frontier;
+    for (int cell : invalidated) {
+        int best = bestNeighborDistance(cell / cols, cell % cols);
+        if (best != UNREACHABLE) {
+            frontier.push({best + 1, cell});
+        }
+    }
+
+    while (!frontier.empty()) {
+        auto [distance, current] = frontier.top();
+        frontier.pop();
+        if (distances[current] != UNREACHABLE) continue;
+
+        distances[current] = distance;
+        int currentRow = current / cols;
+        int currentCol = current % cols;
+        for (int i = 0; i < 4; ++i) {
+            int neighborRow = currentRow + DIR_ROW[i];
+            int neighborCol = currentCol + DIR_COL[i];
+            if (neighborRow < 0 || neighborRow >= rows || neighborCol < 0 || neighborCol >= cols) continue;
+
+            int neighbor = index(neighborRow, neighborCol);
+            if (marks[neighbor] == MARK_INVALID && distances[neighbor] == UNREACHABLE) {
+                frontier.push({distance + 1, neighbor});
+            }
+        }
+    }
+
+    clearMarks();
+}
+
+
+
+// una celda se libero: propagar las distancias menores que ahora pasan por ella
+void FlowField::unblockCell(int row, int col) {
+    if (!grid) return;
+
+    // liberar el objetivo original, o cualquier celda mientras este bloqueado, puede cambiar la celda objetivo
+    if ((row == requestedGoalRow && col == requestedGoalCol) || !isWalkable(requestedGoalRow, requestedGoalCol)) {
+        compute(grid, worldGoal);
+        return;
+    }
+
+    if (!isWalkable(row, col)) return;
+
+    int best = bestNeighborDistance(row, col);
+    if (best == UNREACHABLE) {
+        return; // sigue aislada del objetivo
+    }
+
+    size_t head = 0;
+    size_t tail = 0;
+    distances[index(row, col)] = best + 1;
+    queue[tail++] = index(row, col);
+
+    while (head < tail) {
+        int current = queue[head++];
+        int currentRow = current / cols;
+        int currentCol = current % cols;
+        int nextDistance = distances[current] + 1;
+
+        for (int i = 0; i < 4; ++i) {
+            int neighborRow = currentRow + DIR_ROW[i];
+            int neighborCol = currentCol + DIR_COL[i];
+            if (!isWalkable(neighborRow, neighborCol)) continue;
+
+            int neighbor = index(neighborRow, neighborCol);
+            if (distances[neighbor] != UNREACHABLE && distances[neighbor] <= nextDistance) continue;
+
+            distances[neighbor] = nextDistance;
+            queue[tail++] = neighbor;
+        }
+    }
+}
+
+
+
+// obtiene la distancia en pasos de una celda al objetivo
+int FlowField::getDistance(int row, int col) const {
+    if (!grid || row < 0 || row >= rows || col < 0 || col >= cols) {
+        return UNREACHABLE;
+    }
+    return distances[index(row, col)];
+}
+
+
+
+// verifica si desde una posicion del mundo se puede llegar al objetivo
+bool FlowField::isReachable(const sf::Vector2f& worldPos) const {
+    if (!grid) return false;
+
+    auto [row, col] = Pathfinding::worldToGrid(worldPos, grid);
+    return findStartCell(row, col);
+}
+
+
+
+// busca la celda de inicio, si esta bloqueada usa la vecina transitable con camino
+bool FlowField::findStartCell(int& row, int& col) const {
+    if (getDistance(row, col) != UNREACHABLE) {
+        return true;
+    }
+
+    for (int r = -1; r <= 1; ++r) {
+        for (int c = -1; c <= 1; ++c) {
+            if (getDistance(row + r, col + c) != UNREACHABLE) {
+                row += r;
+                col += c;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+
+// elige la vecina con menor distancia al objetivo
+bool FlowField::getNextCell(int row, int col, int& nextRow, int& nextCol) const {
+    int currentDistance = getDistance(row, col);
+    if (currentDistance == UNREACHABLE || currentDistance == 0) {
+        return false;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        int neighborRow = row + DIR_ROW[i];
+        int neighborCol = col + DIR_COL[i];
+        if (getDistance(neighborRow, neighborCol) == currentDistance - 1) {
+            nextRow = neighborRow;
+            nextCol = neighborCol;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+
+// sigue el campo de celda en celda hasta el objetivo
+DynamicArray<sf::Vector2f> FlowField::extractPath(const sf::Vector2f& worldStart) const {
+    DynamicArray<sf::Vector2f> path;
+    extractPath(worldStart, path);
+    return path;
+}
+
+
+
+// igual que extractPath pero escribe en un arreglo existente, reutilizando su capacidad
+void FlowField::extractPath(const sf::Vector2f& worldStart, DynamicArray<sf::Vector2f>& path) const {
+    path.clear();
+    if (!grid) return;
+
+    auto [row, col] = Pathfinding::worldToGrid(worldStart, grid);
+    if (!findStartCell(row, col)) {
+        return;
+    }
+
+    path.reserve(getDistance(row, col) + 1);
+    path.push_back(Pathfinding::gridToWorld(row, col, grid));
+
+    int nextRow = row;
+    int nextCol = col;
+    while (getNextCell(row, col, nextRow, nextCol)) {
+        row = nextRow;
+        col = nextCol;
+        path.push_back(Pathfinding::gridToWorld(row, col, grid));
+    }
+}
@@ -0,0 +1,28 @@
+#include "../include/Game/Systems/LaneRandom.h"
+
+// arranca con la semilla por defecto
+LaneRandom::LaneRandom() {
+    RandomStream source;
+    seed(source);
+}
+
+
+
+// cuatro palabras del flujo por carril, un carril en cero quedaria fijo en cero para siempre
+void LaneRandom::seed(RandomStream& source) {
+    uint32_t words[4][SIMD_LANES];
+
+    for (int lane = 0; lane < SIMD_LANES; lane++) {
+        for (int word = 0; word < 4; word++) {
+            words[word][lane] = source();
+        }
+        if ((words[0][lane] | words[1][lane] | words[2][lane] | words[3][lane]) == 0) {
+            words[0][lane] = 1;
+        }
+    }
+
+    s0 = UintLanes::load(words[0]);
+    s1 = UintLanes::load(words[1]);
+    s2 = UintLanes::load(words[2]);
+    s3 = UintLanes::load(words[3]);
+}
@@ -0,0 +1,187 @@
+#include "../include/Game/Systems/Logger.h"
+#include <iostream>
+#include <chrono>
+
+// prepara las casillas del anillo y arranca el hilo de escritura
+Logger::Logger()
+    :   enqueuePosition(0),
+        dequeuePosition(0),
+        minimumLevel(static_cast<uint8_t>(LogLevel::Info)),
+        dropped(0),
+        reportedDrops(0),
+        stopping(false),
+        output(&std::cout) {
+
+    for (size_t i = 0; i < CAPACITY; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    writer = std::thread(&Logger::writerLoop, this);
+}
+
+
+
+// detiene el hilo de escritura y escribe lo que quede pendiente
+Logger::~Logger() {
+    stopping.store(true, std::memory_order_release);
+    if (writer.joinable()) {
+        writer.join();
+    }
+    flush();
+}
+
+
+
+// instancia unica creada en el primer uso
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+
+
+// reserva una casilla libre y copia el mensaje, varios hilos pueden encolar a la vez
+// una casilla esta libre cuando su secuencia coincide con la posicion a escribir
+bool Logger::push(LogLevel level, const char* format, const LogArg* args, size_t argCount) {
+    size_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+
+    while (true) {
+        slot = &slots[position & (CAPACITY - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // el anillo esta lleno, descartar antes que esperar al hilo de escritura
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->record.format = format;
+    slot->record.level = level;
+    slot->record.argCount = static_cast<uint8_t>(argCount);
+    for (size_t i = 0; i < argCount; i++) {
+        slot->record.args[i] = args[i];
+    }
+
+    // publicar la casilla para el consumidor
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+
+
+// escribe los mensajes publicados en orden, requiere writeMutex
+// retorna cuantos mensajes se escribieron
+size_t Logger::drain() {
+    size_t written = 0;
+
+    while (true) {
+        Slot& slot = slots[dequeuePosition & (CAPACITY - 1)];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeuePosition + 1) {
+            break;
+        }
+
+        write(slot.record);
+
+        // liberar la casilla para la siguiente vuelta del anillo
+        slot.sequence.store(dequeuePosition + CAPACITY, std::memory_order_release);
+        dequeuePosition++;
+        written++;
+    }
+
+    if (written > 0) {
+        size_t lost = dropped.load(std::memory_order_relaxed);
+        if (lost > reportedDrops) {
+            *output << "Registro: " << (lost - reportedDrops) << " mensajes descartados por anillo lleno\n";
+            reportedDrops = lost;
+        }
+        output->flush();
+    }
+
+    return written;
+}
+
+
+
+// reemplaza cada {} del formato por el siguiente argumento
+void Logger::write(const LogRecord& record) {
+    std::ostream& out = *output;
+    const char* cursor = record.format;
+    int nextArg = 0;
+
+    while (*cursor) {
+        if (cursor[0] == '{' && cursor[1] == '}' && nextArg < record.argCount) {
+            const LogArg& arg = record.args[nextArg++];
+            switch (arg.kind) {
+                case LogArg::Kind::Integer: out << arg.integer; break;
+                case LogArg::Kind::Unsigned: out << arg.unsignedInteger; break;
+                case LogArg::Kind::Real: out << arg.real; break;
+                case LogArg::Kind::Boolean: out << arg.boolean; break;
+                case LogArg::Kind::Text: out << (arg.text ? arg.text : "(null)"); break;
+            }
+            cursor += 2;
+        } else {
+            out << *cursor;
+            cursor++;
+        }
+    }
+
+    out << '\n';
+}
+
+
+
+// vacia el anillo periodicamente, los productores nunca despiertan a este hilo
+void Logger::writerLoop() {
+    while (!stopping.load(std::memory_order_acquire)) {
+        size_t written;
+        {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            written = drain();
+        }
+
+        if (written == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+}
+
+
+
+// cambia el nivel minimo en tiempo de ejecucion
+void Logger::setLevel(LogLevel level) {
+    minimumLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+
+
+// nivel minimo actual
+LogLevel Logger::getLevel() const {
+    return static_cast<LogLevel>(minimumLevel.load(std::memory_order_relaxed));
+}
+
+
+
+// cambia el destino de los mensajes
+void Logger::setOutput(std::ostream& stream) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    drain();
+    output = &stream;
+}
+
+
+
+// escribe en el hilo que llama todo lo que ya estaba publicado
+void Logger::flush() {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    drain();
+}
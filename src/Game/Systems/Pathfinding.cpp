@@ -5,55 +5,108 @@
 #include <algorithm>
 #include <iostream>
 
-// calcula la heuristica usando distancia manhattan
-float Pathfinding::calculateHeuristic(int r1, int c1, int r2, int c2) {
-   return static_cast<float>(std::abs(r1 - r2) + std::abs(c1 - c2));
-}
+// espacio de trabajo de a* reutilizado entre busquedas, uno por hilo
+// los arreglos son planos por celda y se invalidan con un sello de generacion en lugar de limpiarse
+struct SearchWorkspace {
+    int cellCount = 0;
+    unsigned int stamp = 0;
+    DynamicArray<unsigned int> openedStamp; // la celda tiene g y parent validos en esta busqueda
+    DynamicArray<int> g;
+    DynamicArray<int> f;
+    DynamicArray<int> parent;
+    DynamicArray<int> heapIndex;            // posicion en el heap, -1 si ya esta cerrada
+    DynamicArray<int> heap;                 // heap binario minimo de indices de celda
+    int heapSize = 0;
+
+    // prepara los arreglos para una nueva busqueda sin recorrerlos
+    void begin(int cells) {
+        if (cells != cellCount) {
+            cellCount = cells;
+            openedStamp.resize(cells);
+            g.resize(cells);
+            f.resize(cells);
+            parent.resize(cells);
+            heapIndex.resize(cells);
+            heap.resize(cells);
+            stamp = 0;
+        }
+
+        // al desbordar el sello hay que limpiar de verdad
+        if (++stamp == 0 || stamp == 1) {
+            for (unsigned int& value : openedStamp) value = 0;
+            stamp = 1;
+        }
+        heapSize = 0;
+    }
+
+    bool isOpened(int cell) const { return openedStamp[cell] == stamp; }
+
+    // menor f primero, en empate la celda con mayor g (mas cerca del objetivo)
+    bool less(int a, int b) const {
+        return f[a] < f[b] || (f[a] == f[b] && g[a] > g[b]);
+    }
+
+    void place(int position, int cell) {
+        heap[position] = cell;
+        heapIndex[cell] = position;
+    }
+
+    void siftUp(int position) {
+        int cell = heap[position];
+        while (position > 0) {
+            int parentPosition = (position - 1) / 2;
+            if (!less(cell, heap[parentPosition])) break;
+            place(position, heap[parentPosition]);
+            position = parentPosition;
+        }
+        place(position, cell);
+    }
+
+    void siftDown(int position) {
+        int cell = heap[position];
+        while (true) {
+            int child = position * 2 + 1;
+            if (child >= heapSize) break;
+            if (child + 1 < heapSize && less(heap[child + 1], heap[child])) child++;
+            if (!less(heap[child], cell)) break;
+            place(position, heap[child]);
+            position = child;
+        }
+        place(position, cell);
+    }
+
+    void push(int cell) {
+        heap[heapSize] = cell;
+        heapIndex[cell] = heapSize;
+        siftUp(heapSize++);
+    }
+
+    int pop() {
+        int top = heap[0];
+        heapIndex[top] = -1;
+        heapSize--;
+        if (heapSize > 0) {
+            heap[0] = heap[heapSize];
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+static thread_local SearchWorkspace workspace;
 
 
 
-// verifica si una celda esta dentro de los limites del grid
-bool Pathfinding::isValidCell(int row, int col, Grid* grid) {
-   return row >= 0 && row < grid->getRows() && col >= 0 && col < grid->getCols();
+// calcula la heuristica usando distancia manhattan
+int Pathfinding::calculateHeuristic(int r1, int c1, int r2, int c2) {
+   return std::abs(r1 - r2) + std::abs(c1 - c2);
 }
 
 
 
-// verifica si una celda es transitable (no tiene torre)
+// verifica si una celda es transitable (no tiene torre), leyendo el mapa de bits del grid
 bool Pathfinding::isCellWalkable(int row, int col, Grid* grid) {
-   if (!isValidCell(row, col, grid)) {
-       return false;
-   }
-
-   Cell* cell = grid->getCellAt(row, col);
-   if (!cell) {
-       return false;
-   }
-
-   // una celda es transitable si no tiene una torre
-   return !cell->hasTower();
-}
-
-
-
-// obtiene los vecinos validos de una celda (4 direcciones)
-DynamicArray<std::pair<int, int>> Pathfinding::getNeighbors(int row, int col, Grid* grid) {
-   DynamicArray<std::pair<int, int>> neighbors;
-
-   // 4 direcciones: arriba, abajo, izquierda, derecha
-   const int dr[] = {-1, 0, 1, 0};
-   const int dc[] = {0, 1, 0, -1};
-
-   for (int i = 0; i < 4; ++i) {
-       int newRow = row + dr[i];
-       int newCol = col + dc[i];
-
-       if (isCellWalkable(newRow, newCol, grid)) {
-           neighbors.push_back({newRow, newCol});
-       }
-   }
-
-   return neighbors;
+   return grid->isWalkable(row, col);
 }
 
 
@@ -91,28 +144,28 @@ sf::Vector2f Pathfinding::gridToWorld(int row, int col, Grid* grid) {
 
 
 
-// reconstruye el camino desde el nodo final hasta el inicial
-DynamicArray<sf::Vector2f> Pathfinding::reconstructPath(std::shared_ptr<Node> endNode, Grid* grid) {
-   DynamicArray<sf::Vector2f> path;
-
-   std::shared_ptr<Node> current = endNode;
-   while (current != nullptr) {
-       // convertir coordenadas de grid a mundo
-       sf::Vector2f worldPos = gridToWorld(current->row, current->col, grid);
-       path.push_back(worldPos);
-       current = current->parent;
+// reconstruye el camino siguiendo los padres desde la celda final hasta la inicial
+DynamicArray<sf::Vector2f> Pathfinding::reconstructPath(const int* parents, int endIndex, int cols, Grid* grid) {
+   // contar primero para reservar el camino de una sola vez
+   size_t length = 0;
+   for (int cell = endIndex; cell != -1; cell = parents[cell]) {
+       length++;
    }
 
-   // invertir el camino para que vaya del inicio al final
-   std::reverse(path.begin(), path.end());
+   DynamicArray<sf::Vector2f> path(length);
+   size_t position = length;
+   for (int cell = endIndex; cell != -1; cell = parents[cell]) {
+       path[--position] = gridToWorld(cell / cols, cell % cols, grid);
+   }
 
    return path;
 }
 
 
 
-// implementacion principal del algoritmo a*
-DynamicArray<sf::Vector2f> Pathfinding::findPath(Grid* grid, const sf::Vector2f& worldStart, const sf::Vector2f& worldGoal) {
+// busqueda a* sobre arreglos planos, sin reservar memoria por consulta
+// retorna el indice de la celda objetivo alcanzada o -1 si no hay camino
+int Pathfinding::search(Grid* grid, const sf::Vector2f& worldStart, const sf::Vector2f& worldGoal) {
    // convertir coordenadas del mundo a indices del grid
    auto [startRow, startCol] = worldToGrid(worldStart, grid);
    auto [goalRow, goalCol] = worldToGrid(worldGoal, grid);
@@ -132,7 +185,7 @@ DynamicArray<sf::Vector2f> Pathfinding::findPath(Grid* grid, const sf::Vector2f&
                    }
                }
            }
-           if (!found) return {}; // no se puede encontrar inicio valido
+           if (!found) return -1; // no se puede encontrar inicio valido
        }
 
        // para el objetivo
@@ -147,89 +200,85 @@ DynamicArray<sf::Vector2f> Pathfinding::findPath(Grid* grid, const sf::Vector2f&
                    }
                }
            }
-           if (!found) return {}; // no se puede encontrar objetivo valido
+           if (!found) return -1; // no se puede encontrar objetivo valido
        }
    }
 
-   // priority queue para la lista abierta (min heap basado en f)
-   std::priority_queue<std::shared_ptr<Node>,
-                      std::vector<std::shared_ptr<Node>>,
-                      NodeCompare> openList;
+   const int rows = grid->getRows();
+   const int cols = grid->getCols();
+   const int goalIndex = goalRow * cols + goalCol;
 
-   // set para rastrear nodos en la lista abierta y cerrada
-   std::unordered_set<std::string> inOpenList;
-   std::unordered_set<std::string> closedList;
+   // 4 direcciones: arriba, derecha, abajo, izquierda
+   const int dr[] = {-1, 0, 1, 0};
+   const int dc[] = {0, 1, 0, -1};
 
-   // crear nodo inicial
-   auto startNode = std::make_shared<Node>(startRow, startCol);
-   startNode->g = 0;
-   startNode->h = calculateHeuristic(startRow, startCol, goalRow, goalCol);
-   startNode->f = startNode->g + startNode->h;
+   SearchWorkspace& ws = workspace;
+   ws.begin(rows * cols);
 
-   openList.push(startNode);
-   inOpenList.insert(std::to_string(startRow) + "," + std::to_string(startCol));
+   // abrir nodo inicial
+   int startIndex = startRow * cols + startCol;
+   ws.openedStamp[startIndex] = ws.stamp;
+   ws.g[startIndex] = 0;
+   ws.f[startIndex] = calculateHeuristic(startRow, startCol, goalRow, goalCol);
+   ws.parent[startIndex] = -1;
+   ws.push(startIndex);
 
    // algoritmo a*
-   while (!openList.empty()) {
-       // obtener el nodo con menor f
-       auto current = openList.top();
-       openList.pop();
-
-       std::string currentKey = std::to_string(current->row) + "," + std::to_string(current->col);
-       inOpenList.erase(currentKey);
-
-       // verificar si llegamos al objetivo
-       if (current->row == goalRow && current->col == goalCol) {
-           return reconstructPath(current, grid);
+   while (ws.heapSize > 0) {
+       // obtener la celda con menor f, queda cerrada
+       int current = ws.pop();
+       if (current == goalIndex) {
+           return current;
        }
 
-       // agregar a la lista cerrada
-       closedList.insert(currentKey);
-
-       // explorar vecinos
-       auto neighbors = getNeighbors(current->row, current->col, grid);
-
-       for (const auto& [neighborRow, neighborCol] : neighbors) {
-           std::string neighborKey = std::to_string(neighborRow) + "," + std::to_string(neighborCol);
-
-           // si ya esta en la lista cerrada, ignorar
-           if (closedList.find(neighborKey) != closedList.end()) {
-               continue;
+       int currentRow = current / cols;
+       int currentCol = current % cols;
+       int tentativeG = ws.g[current] + 1;
+
+       // explorar vecinos transitables
+       for (int i = 0; i < 4; ++i) {
+           int neighborRow = currentRow + dr[i];
+           int neighborCol = currentCol + dc[i];
+           if (!isCellWalkable(neighborRow, neighborCol, grid)) continue;
+
+           int neighbor = neighborRow * cols + neighborCol;
+           if (!ws.isOpened(neighbor)) {
+               // primera vez que se alcanza la celda
+               ws.openedStamp[neighbor] = ws.stamp;
+               ws.g[neighbor] = tentativeG;
+               ws.f[neighbor] = tentativeG + calculateHeuristic(neighborRow, neighborCol, goalRow, goalCol);
+               ws.parent[neighbor] = current;
+               ws.push(neighbor);
+           } else if (ws.heapIndex[neighbor] >= 0 && tentativeG < ws.g[neighbor]) {
+               // camino mas corto hacia una celda abierta, reducir su prioridad
+               ws.f[neighbor] -= ws.g[neighbor] - tentativeG;
+               ws.g[neighbor] = tentativeG;
+               ws.parent[neighbor] = current;
+               ws.siftUp(ws.heapIndex[neighbor]);
            }
+       }
+   }
 
-           // calcular el costo g tentativo
-           float moveCost = 1.0f;
-           float tentativeG = current->g + moveCost;
+   // no se encontro camino
+   return -1;
+}
 
-           // verificar si ya esta en la lista abierta
-           bool inOpen = inOpenList.find(neighborKey) != inOpenList.end();
 
-           if (!inOpen || tentativeG < current->g) {
-               // crear o actualizar el nodo vecino
-               auto neighbor = std::make_shared<Node>(neighborRow, neighborCol);
-               neighbor->g = tentativeG;
-               neighbor->h = calculateHeuristic(neighborRow, neighborCol, goalRow, goalCol);
-               neighbor->f = neighbor->g + neighbor->h;
-               neighbor->parent = current;
 
-               if (!inOpen) {
-                   openList.push(neighbor);
-                   inOpenList.insert(neighborKey);
-               }
-           }
-       }
+// implementacion principal del algoritmo a*
+DynamicArray<sf::Vector2f> Pathfinding::findPath(Grid* grid, const sf::Vector2f& worldStart, const sf::Vector2f& worldGoal) {
+   int endIndex = search(grid, worldStart, worldGoal);
+   if (endIndex < 0) {
+       return {};
    }
-
-   // no se encontro camino
-   return {};
+   return reconstructPath(workspace.parent.begin(), endIndex, grid->getCols(), grid);
 }
 
 
 
-// verifica si existe un camino valido
+// verifica si existe un camino valido sin construir la lista de puntos
 bool Pathfinding::hasValidPath(Grid* grid, const sf::Vector2f& worldStart, const sf::Vector2f& worldGoal) {
-   auto path = findPath(grid, worldStart, worldGoal);
-   return !path.empty();
+   return search(grid, worldStart, worldGoal) >= 0;
 }
 
 
@@ -0,0 +1,77 @@
+#include "../include/Game/Systems/PopulationEvaluator.h"
+#include "../include/Game/Systems/Simulation.h"
+
+// valida la distribucion una sola vez y prepara los hilos de evaluacion
+PopulationEvaluator::PopulationEvaluator(const DynamicArray<TowerPlacement>& placements, const TrialConfig& config, int threadCount)
+    :   config(config),
+        pool(threadCount),
+        pathLength(0.0f) {
+
+    // conservar solo las torres que se pueden colocar, asi cada prueba no repite los avisos
+    Simulation probe(0.0f, 0.0f, config.rows, config.cols, config.cellSize, 1);
+    for (const auto& placement : placements) {
+        DynamicArray<TowerPlacement> single;
+        single.push_back(placement);
+        if (TowerLayout::apply(probe, single) > 0) {
+            layout.push_back(placement);
+        }
+    }
+
+    pathLength = probe.getPathLength();
+}
+
+
+
+// simula una oleada con un solo enemigo y devuelve su rendimiento
+EnemyPerformance PopulationEvaluator::runTrial(const Chromosome& chromosome, int waveNumber, uint64_t seed) const {
+    Simulation trial(0.0f, 0.0f, config.rows, config.cols, config.cellSize, 1, 0.0f, 0.0f, 1.5f, seed);
+    trial.setRecordEvents(false);
+    trial.setAutoAdvanceGenerations(false);
+    TowerLayout::apply(trial, layout);
+
+    trial.startTrial(chromosome, waveNumber);
+    trial.runUntilWaveEnds(config.timestep, config.maxTrialTime);
+
+    // registrar al enemigo si sigue vivo al agotar el tiempo
+    trial.collectEnemyPerformanceData();
+
+    EnemyPerformance performance;
+    const WaveManager& waves = trial.getWaveManager();
+    DynamicArray<bool> reachedEnd = waves.getEnemiesReachedEnd();
+    if (!reachedEnd.empty()) {
+        performance.reachedEnd = reachedEnd[0];
+        performance.distanceTraveled = waves.getDistancesTraveled()[0];
+        performance.damageReceived = waves.getDamagesReceived()[0];
+        performance.timeAlive = waves.getTimesAlive()[0];
+    }
+
+    return performance;
+}
+
+
+
+// reparte las pruebas entre los hilos y combina los resultados en el orden de la poblacion
+DynamicArray<EnemyPerformance> PopulationEvaluator::evaluate(Genetics& genetics, int waveNumber, uint64_t seed) {
+    const PopulationStore& population = genetics.getPopulation();
+    size_t count = population.size();
+    DynamicArray<EnemyPerformance> results(count);
+
+    // la semilla de cada prueba depende solo de su indice, el resultado no depende del orden de los hilos
+    pool.parallelFor(count, [&](size_t i) {
+        results[i] = runTrial(population.get(i), waveNumber, RandomService::mixSeed(seed, i));
+    });
+
+    DynamicArray<bool> reachedEnd;
+    DynamicArray<float> distancesTraveled;
+    DynamicArray<float> damagesReceived;
+    DynamicArray<float> timesAlive;
+    for (const auto& result : results) {
+        reachedEnd.push_back(result.reachedEnd);
+        distancesTraveled.push_back(result.distanceTraveled);
+        damagesReceived.push_back(result.damageReceived);
+        timesAlive.push_back(result.timeAlive);
+    }
+
+    genetics.evaluatePopulation(reachedEnd, distancesTraveled, damagesReceived, timesAlive);
+    return results;
+}
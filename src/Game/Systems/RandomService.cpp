@@ -0,0 +1,119 @@
+#include "../include/Game/Systems/RandomService.h"
+#include <chrono>
+
+// expande una semilla de 64 bits en valores bien distribuidos (splitmix64)
+static uint64_t splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+
+
+// rota los bits de un entero hacia la izquierda
+static inline uint32_t rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+
+
+// crea un flujo con la semilla por defecto
+RandomStream::RandomStream() {
+    seed(RandomService::DEFAULT_SEED);
+}
+
+
+
+// crea un flujo con una semilla especifica
+RandomStream::RandomStream(uint64_t seedValue) {
+    seed(seedValue);
+}
+
+
+
+// inicializa el estado interno a partir de la semilla
+void RandomStream::seed(uint64_t seedValue) {
+    uint64_t x = seedValue;
+    uint64_t a = splitMix64(x);
+    uint64_t b = splitMix64(x);
+    state[0] = static_cast<uint32_t>(a);
+    state[1] = static_cast<uint32_t>(a >> 32);
+    state[2] = static_cast<uint32_t>(b);
+    state[3] = static_cast<uint32_t>(b >> 32);
+}
+
+
+
+// genera el siguiente numero de 32 bits
+uint32_t RandomStream::operator()() {
+    const uint32_t result = rotl(state[1] * 5, 7) * 9;
+    const uint32_t t = state[1] << 9;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 11);
+
+    return result;
+}
+
+
+
+// usa los 24 bits altos para obtener un float exacto en [0, 1)
+float RandomStream::nextFloat() {
+    return static_cast<float>((*this)() >> 8) * (1.0f / 16777216.0f);
+}
+
+
+
+float RandomStream::range(float minValue, float maxValue) {
+    return minValue + (maxValue - minValue) * nextFloat();
+}
+
+
+
+int RandomStream::rangeInt(int minValue, int maxValue) {
+    if (maxValue <= minValue) return minValue;
+    uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(maxValue) - minValue + 1);
+    return minValue + static_cast<int>((static_cast<uint64_t>((*this)()) * span) >> 32);
+}
+
+
+
+// crea el servicio y deriva los flujos de todos los subsistemas
+RandomService::RandomService(uint64_t seed) {
+    reseed(seed);
+}
+
+
+
+// reinicia todos los flujos a partir de una nueva semilla de ejecucion
+void RandomService::reseed(uint64_t seed) {
+    runSeed = seed;
+    uint64_t x = seed;
+    for (auto& stream : streams) {
+        stream.seed(splitMix64(x));
+    }
+}
+
+
+
+RandomStream& RandomService::stream(RandomSubsystem subsystem) {
+    return streams[static_cast<int>(subsystem)];
+}
+
+
+
+uint64_t RandomService::mixSeed(uint64_t seed, uint64_t salt) {
+    uint64_t x = seed ^ (salt * 0xD1B54A32D192ED03ULL);
+    return splitMix64(x);
+}
+
+
+
+uint64_t RandomService::timeSeed() {
+    return static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+}
@@ -0,0 +1,403 @@
+#include "../include/Game/Systems/Simulation.h"
+#include "../include/Game/Systems/Pathfinding.h"
+#include "../include/Game/Towers/Archer.h"
+#include "../include/Game/Systems/Logger.h"
+#include <cmath>
+
+// construye todos los sistemas de la simulacion sin iniciar oleadas
+Simulation::Simulation(float gridX, float gridY, int rows, int cols, float cellSize,
+                       int populationSize, float mutationRate, float crossoverRate,
+                       float enemySpawnInterval, uint64_t seed)
+    :   enemyPool(enemyStore),
+        random(seed),
+        recordEvents(true),
+        autoAdvanceGenerations(true),
+        enemiesKilled(0),
+        enemiesReachedEnd(0),
+        pathLength(0.0f) {
+
+    // crear cuadricula logica
+    grid = std::make_unique<Grid>(gridX, gridY, rows, cols, cellSize);
+
+    // definir puntos de entrada y salida de enemigos
+    initializeSpawnAndGoalPoints();
+
+    // indice espacial de enemigos con cubetas del tamano de una celda
+    enemyIndex.configure(gridX, gridY, cols * cellSize, rows * cellSize, cellSize);
+
+    // inicializar algoritmo genetico
+    genetics = std::make_unique<Genetics>(populationSize, mutationRate, crossoverRate, random);
+
+    // calcular campo de flujo compartido y camino inicial para establecer longitud de referencia
+    flowField.compute(grid.get(), goalPoint);
+    auto initialPath = flowField.extractPath(spawnPoint);
+
+    // inicializar gestor de oleadas con parametros base
+    waveManager = std::make_unique<WaveManager>(initialPath, grid.get(), goalPoint, enemySpawnInterval);
+    waveManager->setClock(&clock);
+    waveManager->setRandomStream(&random.stream(RandomSubsystem::Waves));
+    waveManager->setFlowField(&flowField);
+    waveManager->setEnemyPool(&enemyPool);
+
+    // los temporales de oleadas y generaciones salen de la arena del paso
+    waveManager->setScratchMemory(&frameArena);
+    genetics->setScratchMemory(&frameArena);
+
+    // establecer longitud del camino en ambos sistemas para calculos de fitness
+    if (!initialPath.empty()) {
+        for (size_t i = 0; i < initialPath.size() - 1; i++) {
+            sf::Vector2f segment = initialPath[i+1] - initialPath[i];
+            pathLength += std::sqrt(segment.x * segment.x + segment.y * segment.y);
+        }
+        waveManager->setPathTotalLength(pathLength);
+        genetics->setPathTotalLength(pathLength);
+    }
+}
+
+
+
+// define donde aparecen los enemigos y hacia donde se dirigen
+void Simulation::initializeSpawnAndGoalPoints() {
+    float gridStartX = grid->getX();
+    float gridStartY = grid->getY();
+    int rows = grid->getRows();
+    int cols = grid->getCols();
+    float cellSize = grid->getCellSize();
+
+    // usar fila central para el camino principal
+    int middleRow = rows / 2;
+
+    // punto de aparicion en el borde izquierdo
+    spawnPoint = sf::Vector2f(gridStartX - cellSize/2, gridStartY + middleRow * cellSize + cellSize/2);
+
+    // punto objetivo en el borde derecho
+    goalPoint = sf::Vector2f(gridStartX + (cols + 1) * cellSize + cellSize / 2, gridStartY + middleRow * cellSize + cellSize / 2);
+}
+
+
+
+// comienza la primera oleada con cromosomas de la poblacion inicial
+void Simulation::start() {
+    DynamicArray<Chromosome> firstWaveChromosomes = genetics->getChromosomesForWave(1);
+    waveManager->setWaveChromosomes(firstWaveChromosomes);
+    waveManager->startNextWave();
+}
+
+
+
+// inicia una oleada aislada con un solo enemigo del cromosoma dado
+void Simulation::startTrial(const Chromosome& chromosome, int waveNumber) {
+    DynamicArray<Chromosome> trialChromosomes;
+    trialChromosomes.push_back(chromosome);
+    waveManager->setWaveChromosomes(trialChromosomes);
+    waveManager->startWave(waveNumber, 1);
+}
+
+
+
+// avanza la simulacion un paso de tiempo dt
+void Simulation::step(float dt) {
+    // avanzar el tiempo simulado antes de consultar temporizadores
+    clock.advance(dt);
+
+    // obtener nuevos enemigos del gestor de oleadas
+    spawnedEnemies.clear();
+    waveManager->update(dt, spawnedEnemies);
+
+    // agregar nuevos enemigos, el gestor de oleadas ya les asigno camino desde el campo de flujo
+    for (auto& enemy : spawnedEnemies) {
+        enemy->setEventQueue(eventQueue());
+        enemyPool.adopt(*enemy);
+        enemies.push_back(std::move(enemy));
+    }
+
+    // actualizar estados individuales de enemigos
+    updateEnemyStates(dt);
+
+    // procesar ataques de todas las torres
+    handleTowerAttacks(dt);
+
+    // preparar la siguiente generacion cuando la oleada termina
+    if (autoAdvanceGenerations && isWaveFinished()) {
+        advanceGeneration();
+    }
+
+    // ningun temporal del paso sigue vivo, la memoria queda lista para el siguiente
+    frameArena.reset();
+}
+
+
+
+// avanza la simulacion una cantidad de segundos en pasos fijos, sin esperar tiempo real
+void Simulation::runFor(float seconds, float timestep) {
+    int steps = static_cast<int>(seconds / timestep + 0.5f);
+    for (int i = 0; i < steps; i++) {
+        step(timestep);
+    }
+}
+
+
+
+// avanza en pasos fijos hasta que la oleada actual termina o se agota el tiempo limite
+// retorna falso si la oleada no termino dentro del limite
+bool Simulation::runUntilWaveEnds(float timestep, float maxSeconds) {
+    double deadline = clock.getTime() + maxSeconds;
+    while (!isWaveFinished()) {
+        if (clock.getTime() >= deadline) {
+            return false;
+        }
+        step(timestep);
+    }
+    return true;
+}
+
+
+
+// la oleada termina cuando ya aparecieron todos sus enemigos y ninguno sigue activo
+bool Simulation::isWaveFinished() const {
+    return enemies.empty() && !waveManager->isWaveInProgress() && waveManager->getEnemiesSpawned() > 0;
+}
+
+
+
+// verifica si se puede colocar una torre sin bloquear caminos
+bool Simulation::canPlaceTowerAt(Cell* cell) {
+    if (!cell || cell->hasTower()) {
+        return false;
+    }
+
+    // simular colocacion temporal reparando solo la region del campo que depende de la celda
+    auto [row, col] = grid->getCellCoordinates(cell);
+    grid->placeTower(row, col, std::make_shared<Archer>());
+    flowField.blockCell(row, col);
+
+    // verificar que sigue existiendo camino desde spawn hasta objetivo
+    bool hasPath = flowField.isReachable(spawnPoint);
+
+    // verificar que enemigos actuales pueden seguir llegando al objetivo
+    if (hasPath) {
+        for (const auto& enemy : enemies) {
+            if (enemy->isAlive() && !flowField.isReachable(enemy->getPosition())) {
+                hasPath = false;
+                break;
+            }
+        }
+    }
+
+    // remover torre temporal, restaurar el campo y devolver resultado
+    grid->placeTower(row, col, nullptr);
+    flowField.unblockCell(row, col);
+    return hasPath;
+}
+
+
+
+// coloca una torre en la celda y recalcula los caminos de los enemigos
+bool Simulation::placeTower(Cell* cell, std::shared_ptr<Tower> tower) {
+    if (!cell || !tower || cell->hasTower()) {
+        return false;
+    }
+
+    tower->setPosition(cell->getCenter());
+    tower->setEventQueue(eventQueue());
+    tower->setClock(&clock);
+    tower->setRandomStream(&random.stream(RandomSubsystem::Towers));
+    auto [row, col] = grid->getCellCoordinates(cell);
+    grid->placeTower(row, col, tower);
+
+    // reparar el campo solo alrededor de la celda bloqueada
+    flowField.blockCell(row, col);
+    recalculateEnemyPaths(cell->getCenter());
+    return true;
+}
+
+
+
+// actualiza los caminos de los enemigos vivos cuya ruta pasaba por la celda bloqueada
+// bloquear una celda solo alarga distancias, asi que las demas rutas siguen siendo minimas
+void Simulation::recalculateEnemyPaths(const sf::Vector2f& changedCell) {
+    for (auto& enemy : enemies) {
+        if (enemy->isAlive() && enemy->isPathThrough(changedCell)) {
+            auto newPath = flowField.extractPath(enemy->getPosition());
+            if (!newPath.empty()) {
+                enemy->setPath(newPath);
+            }
+        }
+    }
+}
+
+
+
+// actualiza el estado de todos los enemigos activos
+void Simulation::updateEnemyStates(float dt) {
+    // mover a todos los enemigos recorriendo las columnas del almacen
+    enemyStore.advance(dt);
+
+    // al remover un enemigo el ultimo ocupa su lugar, se revisa de nuevo la misma posicion
+    for (size_t i = 0; i < enemies.size();) {
+        Enemy& enemy = *enemies[i];
+
+        if (!enemy.isAlive()) {
+            // procesar muerte y devolver enemigo al pool
+            processEnemyDeath(enemy);
+            removeEnemy(i);
+        }
+        else if (enemy.hasReachedEnd()) {
+            // enemigo llego al final, ya no participa en la oleada
+            processEnemyReachedEnd(enemy);
+            removeEnemy(i);
+        }
+        else {
+            ++i;
+        }
+    }
+}
+
+
+
+// devuelve el enemigo al pool y ocupa su lugar con el ultimo, igual que hace el almacen con su fila
+void Simulation::removeEnemy(size_t index) {
+    enemyPool.release(std::move(enemies[index]));
+    enemies.swap_remove(index);
+}
+
+
+
+// procesa los ataques de todas las torres hacia enemigos en rango
+// cada torre consulta solo las cubetas cercanas en lugar de recorrer todos los enemigos
+void Simulation::handleTowerAttacks(float dt) {
+    // las filas del almacen siguen el orden de la lista, el indice sirve para ambos
+    enemyIndex.rebuild(enemyStore.getPositions());
+
+    for (const auto& placed : grid->getTowers()) {
+        const auto& tower = placed.tower;
+        tower->setEnemyIndex(&enemyIndex);
+
+        // la lista no conserva el orden de aparicion, se ataca al vivo que aparecio primero
+        enemyIndex.queryRange(placed.cell->getPosition(), tower->getRange(), targetCandidates);
+        Enemy* target = nullptr;
+        for (int index : targetCandidates) {
+            Enemy* candidate = enemies[index].get();
+            if (candidate->isAlive() && (!target || candidate->getId() < target->getId())) {
+                target = candidate;
+            }
+        }
+        if (target) {
+            tower->attack(*target, enemies); // solo un ataque por ciclo
+        }
+    }
+}
+
+
+
+// registra la muerte de un enemigo y notifica a la capa visual
+void Simulation::processEnemyDeath(Enemy& enemy) {
+    waveManager->trackEnemyDeath(enemy.getId(), enemy);
+    enemiesKilled++;
+    pushEnemyEvent(SimulationEventType::EnemyKilled, enemy, static_cast<float>(enemy.getGoldReward()));
+}
+
+
+
+// registra que un enemigo llego al objetivo
+void Simulation::processEnemyReachedEnd(Enemy& enemy) {
+    waveManager->trackEnemyReachedEnd(enemy.getId(), enemy);
+    enemiesReachedEnd++;
+    pushEnemyEvent(SimulationEventType::EnemyReachedEnd, enemy, 0.0f);
+}
+
+
+
+// agrega un evento de enemigo con su fitness estimado para estadisticas
+void Simulation::pushEnemyEvent(SimulationEventType type, const Enemy& enemy, float amount) {
+    if (!recordEvents) return;
+
+    Chromosome tempChromosome;
+    tempChromosome.calculateFitness(type == SimulationEventType::EnemyReachedEnd,
+                                    enemy.getTotalDistanceTraveled(),
+                                    enemy.getTotalDamageReceived(), enemy.getTimeAlive(),
+                                    1000.0f); // usar longitud del camino de referencia
+
+    SimulationEvent event;
+    event.type = type;
+    event.enemyId = enemy.getId();
+    event.position = enemy.getPosition();
+    event.amount = amount;
+    event.fitness = tempChromosome.getFitness();
+    events.push_back(event);
+}
+
+
+
+// recolecta datos de rendimiento de enemigos que siguen vivos
+void Simulation::collectEnemyPerformanceData() {
+    for (const auto& enemy : enemies) {
+        if (enemy->isAlive()) {
+            waveManager->trackEnemyPerformance(enemy->getId(), false,
+                                             enemy->getTotalDistanceTraveled(),
+                                             enemy->getTotalDamageReceived(),
+                                             enemy->getTimeAlive());
+        }
+    }
+}
+
+
+
+// genera la siguiente generacion, tambien se llama fuera de step asi que limpia la arena al terminar
+void Simulation::prepareNextGeneration() {
+    advanceGeneration();
+    frameArena.reset();
+}
+
+
+
+// evalua la oleada y genera la siguiente generacion usando algoritmo genetico
+// sus temporales salen de la arena del paso y mueren antes de que se limpie
+void Simulation::advanceGeneration() {
+    // recopilar datos finales de enemigos activos
+    collectEnemyPerformanceData();
+
+    // obtener metricas de rendimiento de la oleada completa
+    DynamicArray<bool> reachedEnd = waveManager->getEnemiesReachedEnd(&frameArena);
+    DynamicArray<float> distancesTraveled = waveManager->getDistancesTraveled(&frameArena);
+    DynamicArray<float> damagesReceived = waveManager->getDamagesReceived(&frameArena);
+    DynamicArray<float> timesAlive = waveManager->getTimesAlive(&frameArena);
+
+    // devolver enemigos restantes al pool desde el final, asi liberar cada fila no mueve a las demas
+    for (size_t i = enemies.size(); i > 0; i--) {
+        enemyPool.release(std::move(enemies[i - 1]));
+    }
+    enemies.clear();
+
+    // evaluar poblacion con datos reales de rendimiento
+    genetics->evaluatePopulation(reachedEnd, distancesTraveled, damagesReceived, timesAlive);
+
+    // guardar resumen de la generacion antes de reemplazarla
+    lastGenerationStats.generation = genetics->getGeneration();
+    lastGenerationStats.wave = waveManager->getCurrentWave();
+    lastGenerationStats.enemies = static_cast<int>(reachedEnd.size());
+    lastGenerationStats.reachedEnd = 0;
+    for (bool reached : reachedEnd) {
+        if (reached) lastGenerationStats.reachedEnd++;
+    }
+    lastGenerationStats.averageFitness = genetics->getAverageFitness();
+    lastGenerationStats.bestFitness = genetics->getBestChromosome().getFitness();
+    lastGenerationStats.diversity = genetics->getDiversityMetric();
+    lastGenerationStats.peakEnemies = static_cast<int>(enemyPool.getHighWater());
+    enemyPool.resetHighWater();
+
+    // crear nueva generacion mediante seleccion, cruzamiento y mutacion
+    genetics->createNextGeneration();
+    lastGenerationStats.mutationRate = genetics->getMutationRate();
+    lastGenerationStats.mutationCount = genetics->getMutationCount();
+
+    // seleccionar mejores cromosomas para la siguiente oleada
+    int nextWaveSize = waveManager->getEnemiesPerWave();
+    DynamicArray<Chromosome> nextWaveChromosomes = genetics->getChromosomesForWave(nextWaveSize, &frameArena);
+
+    GK_LOG_INFO("Cromosomas seleccionados para oleada: {} (necesarios: {})", nextWaveChromosomes.size(), nextWaveSize);
+
+    // configurar gestor de oleadas con nuevos cromosomas y comenzar
+    waveManager->setWaveChromosomes(nextWaveChromosomes);
+    waveManager->startNextWave();
+}
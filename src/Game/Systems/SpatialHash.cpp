@@ -0,0 +1,105 @@
+#include "../include/Game/Systems/SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHash::SpatialHash()
+    : originX(0.0f), originY(0.0f), bucketSize(1.0f), bucketCols(0), bucketRows(0) {
+}
+
+
+
+// prepara las cubetas para cubrir el rectangulo indicado
+void SpatialHash::configure(float x, float y, float width, float height, float size) {
+    originX = x;
+    originY = y;
+    bucketSize = std::max(1.0f, size);
+    bucketCols = std::max(1, static_cast<int>(std::ceil(width / bucketSize)));
+    bucketRows = std::max(1, static_cast<int>(std::ceil(height / bucketSize)));
+    bucketStart.resize(bucketCols * bucketRows + 1);
+    for (int& start : bucketStart) {
+        start = 0;
+    }
+}
+
+
+
+int SpatialHash::bucketColumn(float worldX) const {
+    int col = static_cast<int>(std::floor((worldX - originX) / bucketSize));
+    return std::max(0, std::min(col, bucketCols - 1));
+}
+
+
+
+int SpatialHash::bucketRow(float worldY) const {
+    int row = static_cast<int>(std::floor((worldY - originY) / bucketSize));
+    return std::max(0, std::min(row, bucketRows - 1));
+}
+
+
+
+// ordena los elementos por cubeta: contar, acumular y colocar
+void SpatialHash::rebuild(const DynamicArray<sf::Vector2f>& itemPositions) {
+    positions = itemPositions;
+    size_t count = positions.size();
+    int bucketCount = bucketCols * bucketRows;
+
+    for (int& start : bucketStart) {
+        start = 0;
+    }
+
+    // contar cuantos elementos caen en cada cubeta
+    entryBucket.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        int bucket = bucketRow(positions[i].y) * bucketCols + bucketColumn(positions[i].x);
+        entryBucket[i] = bucket;
+        bucketStart[bucket + 1]++;
+    }
+
+    // acumular para obtener el inicio de cada cubeta
+    for (int bucket = 0; bucket < bucketCount; bucket++) {
+        bucketStart[bucket + 1] += bucketStart[bucket];
+    }
+
+    // colocar cada elemento en su cubeta, usando el inicio como cursor
+    entries.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        entries[bucketStart[entryBucket[i]]++] = static_cast<int>(i);
+    }
+
+    // los cursores quedaron al final de cada cubeta, desplazarlos de vuelta al inicio
+    for (int bucket = bucketCount; bucket > 0; bucket--) {
+        bucketStart[bucket] = bucketStart[bucket - 1];
+    }
+    bucketStart[0] = 0;
+}
+
+
+
+// revisa solo las cubetas que cubren el cuadrado del circulo de busqueda
+void SpatialHash::queryRange(const sf::Vector2f& center, float radius, DynamicArray<int>& result) const {
+    result.clear();
+    if (positions.empty()) return;
+
+    int minCol = bucketColumn(center.x - radius);
+    int maxCol = bucketColumn(center.x + radius);
+    int minRow = bucketRow(center.y - radius);
+    int maxRow = bucketRow(center.y + radius);
+    float radiusSquared = radius * radius;
+
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int col = minCol; col <= maxCol; col++) {
+            int bucket = row * bucketCols + col;
+            for (int i = bucketStart[bucket]; i < bucketStart[bucket + 1]; i++) {
+                int item = entries[i];
+                float dx = positions[item].x - center.x;
+                float dy = positions[item].y - center.y;
+                if (dx * dx + dy * dy <= radiusSquared) {
+                    result.push_back(item);
+                }
+            }
+        }
+    }
+
+    // mantener el orden original de los elementos para que el resultado sea determinista
+    std::sort(result.begin(), result.end());
+}
@@ -0,0 +1,85 @@
+#include "../include/Game/Systems/ThreadPool.h"
+
+// crea los hilos de trabajo que esperaran lotes de tareas
+ThreadPool::ThreadPool(int threadCount)
+    :   taskCount(0),
+        nextIndex(0),
+        activeWorkers(0),
+        batchId(0),
+        stopping(false) {
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    threadCount = std::max(1, threadCount);
+
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; i++) {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+
+
+// detiene y espera a todos los hilos
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+
+
+// reparte los indices entre los hilos, cada uno toma el siguiente libre hasta agotarlos
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    if (count == 0) return;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    task = fn;
+    taskCount = count;
+    nextIndex = 0;
+    activeWorkers = static_cast<int>(workers.size());
+    batchId++;
+    wakeCondition.notify_all();
+
+    // esperar a que todos los hilos terminen el lote
+    doneCondition.wait(lock, [this] { return activeWorkers == 0; });
+    task = nullptr;
+}
+
+
+
+// ciclo de cada hilo: esperar un lote nuevo, procesar indices y reportar que termino
+void ThreadPool::workerLoop() {
+    unsigned long seenBatch = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeCondition.wait(lock, [this, seenBatch] { return stopping || batchId != seenBatch; });
+            if (stopping) return;
+            seenBatch = batchId;
+        }
+
+        // tomar indices hasta que no queden, sin bloquear a los demas hilos
+        for (size_t i = nextIndex.fetch_add(1); i < taskCount; i = nextIndex.fetch_add(1)) {
+            task(i);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeWorkers--;
+            if (activeWorkers == 0) {
+                doneCondition.notify_one();
+            }
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include "../include/Game/Systems/TowerLayout.h"
+#include "../include/Game/Systems/Simulation.h"
+#include "../include/Game/Towers/Archer.h"
+#include "../include/Game/Towers/Mage.h"
+#include "../include/Game/Towers/Gunner.h"
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+// lee la distribucion de torres desde un archivo de texto
+bool TowerLayout::loadFromFile(const std::string& filename, DynamicArray<TowerPlacement>& placements) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error abriendo distribucion de torres: " << filename << "\n";
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+
+        // descartar comentarios y lineas vacias
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line = line.substr(0, comment);
+        }
+
+        std::istringstream stream(line);
+        TowerPlacement placement;
+        if (!(stream >> placement.row >> placement.col >> placement.type)) {
+            if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                std::cerr << "Linea " << lineNumber << " invalida en " << filename << "\n";
+                return false;
+            }
+            continue;
+        }
+
+        // el nivel es opcional
+        if (!(stream >> placement.level)) {
+            placement.level = 1;
+        }
+
+        placements.push_back(placement);
+    }
+
+    return true;
+}
+
+
+
+// construye una torre a partir de su nombre de tipo
+std::shared_ptr<Tower> TowerLayout::createTower(const std::string& type) {
+    if (type == "Archer") return std::make_shared<Archer>();
+    if (type == "Mage") return std::make_shared<Mage>();
+    if (type == "Gunner") return std::make_shared<Gunner>();
+    return nullptr;
+}
+
+
+
+// coloca las torres en la simulacion respetando que siempre exista un camino
+int TowerLayout::apply(Simulation& simulation, const DynamicArray<TowerPlacement>& placements) {
+    int placed = 0;
+
+    for (const auto& placement : placements) {
+        Cell* cell = simulation.getGrid().getCellAt(placement.row, placement.col);
+        auto tower = createTower(placement.type);
+
+        if (!tower) {
+            std::cerr << "Tipo de torre desconocido: " << placement.type << "\n";
+            continue;
+        }
+
+        if (!simulation.canPlaceTowerAt(cell)) {
+            std::cerr << "No se puede colocar " << placement.type << " en ("
+                      << placement.row << ", " << placement.col << ")\n";
+            continue;
+        }
+
+        simulation.placeTower(cell, tower);
+
+        // subir de nivel hasta el indicado en la distribucion
+        while (tower->getLevel() < placement.level && tower->canUpgrade()) {
+            tower->upgrade();
+        }
+
+        placed++;
+    }
+
+    return placed;
+}
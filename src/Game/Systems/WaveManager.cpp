@@ -26,7 +26,13 @@ WaveManager::WaveManager(const DynamicArray<sf::Vector2f>& path, Grid* grid, con
         lastWaveAvgProgress(0.0f),
         lastWaveAvgDamage(0.0f),
         lastWaveEffectiveness(0.0f),
-        lastWaveReachedCount(0) {
+        lastWaveReachedCount(0),
+        enemyPerformanceData(ResourceAllocator<std::pair<const int, EnemyPerformance>>(&performanceNodes)),
+        clock(nullptr),
+        random(nullptr),
+        flowField(nullptr),
+        enemyPool(nullptr),
+        scratch(nullptr) {
 
     // configurar punto de aparicion en el inicio del camino
     if (!path.empty()) {
@@ -60,9 +66,8 @@ void WaveManager::calculatePathLength() {
 
 
 // genera enemigos durante una oleada activa segun intervalos configurados
-DynamicArray<std::unique_ptr<Enemy>> WaveManager::update(float dt) {
-    DynamicArray<std::unique_ptr<Enemy>> newEnemies;
-
+// los enemigos nuevos se agregan al final de newEnemies
+void WaveManager::update(float dt, DynamicArray<std::unique_ptr<Enemy>>& newEnemies) {
     // verificar si es momento de generar un nuevo enemigo
     if (waveInProgress && enemiesRemaining > 0) {
         if (enemySpawnTimer.getElapsedTime().asSeconds() >= enemySpawnInterval) {
@@ -76,10 +81,8 @@ DynamicArray<std::unique_ptr<Enemy>> WaveManager::update(float dt) {
 
                 } else {
                     // seleccionar cromosoma aleatorio de los disponibles
-                    std::random_device rd;
-                    std::mt19937 gen(rd());
-                    std::uniform_int_distribution<size_t> dist(0, currentWaveChromosomes.size() - 1);
-                    chromosome = currentWaveChromosomes[dist(gen)];
+                    size_t index = random ? random->rangeInt(0, currentWaveChromosomes.size() - 1) : 0;
+                    chromosome = currentWaveChromosomes[index];
                 }
 
             } else {
@@ -98,30 +101,42 @@ DynamicArray<std::unique_ptr<Enemy>> WaveManager::update(float dt) {
             enemyPerformanceData[enemiesSpawned] = performance;
 
             // crear tipo de enemigo segun rotacion basada en oleada actual
-            std::unique_ptr<Enemy> enemy;
+            // se reutiliza un enemigo libre del pool si hay uno del mismo tipo
             int enemyType = (currentWave - 1) % 4;  // alternar entre 4 tipos diferentes
+            std::unique_ptr<Enemy> enemy;
+            if (enemyPool) {
+                enemy = enemyPool->acquire(static_cast<EnemyType>(enemyType), spawnPosition, enemyPath, chromosome, currentWave);
+            }
 
-            switch(enemyType) {
-                case 0:
-                    enemy = std::make_unique<Ogre>(spawnPosition, enemyPath, chromosome, currentWave);
-                break;
-                case 1:
-                    enemy = std::make_unique<DarkElves>(spawnPosition, enemyPath, chromosome, currentWave);
-                break;
-                case 2:
-                    enemy = std::make_unique<Harpy>(spawnPosition, enemyPath, chromosome, currentWave);
-                break;
-                case 3:
-                    enemy = std::make_unique<Mercenary>(spawnPosition, enemyPath, chromosome, currentWave);
-                break;
-                default:
-                    enemy = std::make_unique<Ogre>(spawnPosition, enemyPath, chromosome, currentWave);
+            if (!enemy) {
+                switch(enemyType) {
+                    case 0:
+                        enemy = std::make_unique<Ogre>(spawnPosition, enemyPath, chromosome, currentWave);
+                    break;
+                    case 1:
+                        enemy = std::make_unique<DarkElves>(spawnPosition, enemyPath, chromosome, currentWave);
+                    break;
+                    case 2:
+                        enemy = std::make_unique<Harpy>(spawnPosition, enemyPath, chromosome, currentWave);
+                    break;
+                    case 3:
+                        enemy = std::make_unique<Mercenary>(spawnPosition, enemyPath, chromosome, currentWave);
+                    break;
+                    default:
+                        enemy = std::make_unique<Ogre>(spawnPosition, enemyPath, chromosome, currentWave);
+                }
             }
 
             enemy->setId(enemiesSpawned);
+            enemy->setClock(clock);
 
-            // calcular ruta optima usando algoritmo a* si la cuadricula esta disponible
-            if (gridReference && enemy) {
+            // tomar la ruta del campo de flujo compartido, o usar a* si no hay campo asignado
+            if (flowField && flowField->isValid()) {
+                flowField->extractPath(spawnPosition, spawnPath);
+                if (!spawnPath.empty()) {
+                    enemy->setPath(spawnPath);
+                }
+            } else if (gridReference && enemy) {
                 auto initialPath = Pathfinding::findPath(gridReference, spawnPosition, goalPoint);
                 if (!initialPath.empty()) {
                     enemy->setPath(initialPath);
@@ -144,8 +159,6 @@ DynamicArray<std::unique_ptr<Enemy>> WaveManager::update(float dt) {
         waveInProgress = false;
         std::cout << "Oleada " << currentWave << " completada. Enemigos spawneados: " << enemiesSpawned << "\n";
     }
-
-    return newEnemies;
 }
 
 
@@ -202,6 +215,19 @@ void WaveManager::startNextWave() {
 
 
 
+// inicia directamente una oleada especifica sin analizar la anterior, usado en evaluaciones aisladas
+void WaveManager::startWave(int waveNumber, int enemyCount) {
+    currentWave = waveNumber;
+    enemiesPerWave = std::max(1, enemyCount);
+    enemiesSpawned = 0;
+    enemiesRemaining = enemiesPerWave;
+    waveInProgress = true;
+    enemySpawnTimer.restart();
+    enemyPerformanceData.clear();
+}
+
+
+
 // define los cromosomas que se usaran para generar enemigos en la oleada
 void WaveManager::setWaveChromosomes(const DynamicArray<Chromosome>& chromosomes) {
     currentWaveChromosomes = chromosomes;
@@ -264,9 +290,9 @@ void WaveManager::analyzeWavePerformance() {
     std::cout << "=== ANÁLISIS DE OLEADA " << currentWave << " ===\n";
 
     // recopilar todas las metricas en estructuras separadas
-    DynamicArray<float> progressValues;
-    DynamicArray<float> damageValues;
-    DynamicArray<float> effectivenessValues;
+    DynamicArray<float> progressValues(scratch);
+    DynamicArray<float> damageValues(scratch);
+    DynamicArray<float> effectivenessValues(scratch);
 
     float totalProgress = 0.0f;
     float totalDamage = 0.0f;
@@ -424,9 +450,47 @@ void WaveManager::setPathTotalLength(float length) {
 
 
 
+// asigna el reloj de la simulacion usado para aparicion y tiempo de vida
+void WaveManager::setClock(const SimClock* simClock) {
+    clock = simClock;
+    enemySpawnTimer.setClock(simClock);
+}
+
+
+
+// asigna el flujo aleatorio usado al elegir cromosomas de relleno
+void WaveManager::setRandomStream(RandomStream* stream) {
+    random = stream;
+}
+
+
+
+// asigna el campo de flujo del que se toman las rutas de los enemigos nuevos
+void WaveManager::setFlowField(const FlowField* field) {
+    flowField = field;
+}
+
+
+
+// asigna el pool del que se reciclan enemigos en lugar de crearlos
+void WaveManager::setEnemyPool(EnemyPool* pool) {
+    enemyPool = pool;
+}
+
+
+
+// asigna la memoria de temporales internos, por ejemplo la arena del paso de simulacion
+void WaveManager::setScratchMemory(MemoryResource* resource) {
+    scratch = resource;
+}
+
+
+
+// los arreglos de resultados salen de resource si se indica, deben descartarse antes de limpiarlo
 // recopila que enemigos lograron completar el recorrido
-DynamicArray<bool> WaveManager::getEnemiesReachedEnd() const {
-    DynamicArray<bool> result;
+DynamicArray<bool> WaveManager::getEnemiesReachedEnd(MemoryResource* resource) const {
+    DynamicArray<bool> result(resource);
+    result.reserve(enemyPerformanceData.size());
     for (const auto& [id, data] : enemyPerformanceData) {
         result.push_back(data.reachedEnd);
     }
@@ -436,8 +500,9 @@ DynamicArray<bool> WaveManager::getEnemiesReachedEnd() const {
 
 
 // recopila las distancias recorridas por todos los enemigos
-DynamicArray<float> WaveManager::getDistancesTraveled() const {
-    DynamicArray<float> result;
+DynamicArray<float> WaveManager::getDistancesTraveled(MemoryResource* resource) const {
+    DynamicArray<float> result(resource);
+    result.reserve(enemyPerformanceData.size());
     for (const auto& [id, data] : enemyPerformanceData) {
         result.push_back(data.distanceTraveled);
     }
@@ -447,8 +512,9 @@ DynamicArray<float> WaveManager::getDistancesTraveled() const {
 
 
 // recopila el daño total recibido por cada enemigo
-DynamicArray<float> WaveManager::getDamagesReceived() const {
-    DynamicArray<float> result;
+DynamicArray<float> WaveManager::getDamagesReceived(MemoryResource* resource) const {
+    DynamicArray<float> result(resource);
+    result.reserve(enemyPerformanceData.size());
     for (const auto& [id, data] : enemyPerformanceData) {
         result.push_back(data.damageReceived);
     }
@@ -458,8 +524,9 @@ DynamicArray<float> WaveManager::getDamagesReceived() const {
 
 
 // recopila el tiempo de supervivencia de cada enemigo
-DynamicArray<float> WaveManager::getTimesAlive() const {
-    DynamicArray<float> result;
+DynamicArray<float> WaveManager::getTimesAlive(MemoryResource* resource) const {
+    DynamicArray<float> result(resource);
+    result.reserve(enemyPerformanceData.size());
     for (const auto& [id, data] : enemyPerformanceData) {
         result.push_back(data.timeAlive);
     }
@@ -469,8 +536,9 @@ DynamicArray<float> WaveManager::getTimesAlive() const {
 
 
 // recopila la efectividad del daño recibido por cada enemigo
-DynamicArray<float> WaveManager::getDamageEffectiveness() const {
-    DynamicArray<float> result;
+DynamicArray<float> WaveManager::getDamageEffectiveness(MemoryResource* resource) const {
+    DynamicArray<float> result(resource);
+    result.reserve(enemyPerformanceData.size());
     for (const auto& [id, data] : enemyPerformanceData) {
         result.push_back(data.damageEffectiveness);
     }
@@ -4,46 +4,27 @@
 
 #include "Game/Towers/Archer.h"
 #include "Game/Enemies/Enemy.h"
-#include "Core/AudioSystem.h"
+#include "Game/Systems/Logger.h"
 
 
 Archer::Archer() : Tower(
+    TowerType::Archer, // type
     75, // cost
     35, // damage
     280.0f, // range
     1.8f, // attack speed
     6.0f // special cooldown
     ) {
-    texture.loadFromFile("assets/images/towers/Archer.png"); // textura de torre
-    sprite.setTexture(texture);
-
-    // Textura de flecha
-    arrowTexture.loadFromFile("assets/images/towers/Arrow.png");
-
-    // Centrar el origen del sprite
-    sf::FloatRect bounds = sprite.getLocalBounds();
-    sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-
-    // Escalar el sprite (ajusta el tamaño a tu celda)
-    float scaleFactor = 60.f / bounds.width; // Asumiendo que la celda mide 40x40 px
-    sprite.setScale(scaleFactor, scaleFactor);
-
 }
 
 void Archer::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>&) {
     // ataque normal
     float elapsed = attackClock.getElapsedTime().asSeconds();
     if (elapsed >= 1.0f / attackSpeed) {
-        enemy.takeDamage(damage, "arrow");
-
-        // sonido de flecha
-        if (audioSystem) {
-            audioSystem->playSound("arrow");
-        }
+        enemy.takeDamage(damage, DamageType::Arrow);
 
         // Crear flecha
-        Arrow arrow(arrowTexture, sprite.getPosition(), enemy.getPosition());
-        activeArrows.push_back(arrow);
+        notifyShot(enemy, false);
 
         attackClock.restart(); // reinicia el temporizador
     }
@@ -52,9 +33,9 @@ void Archer::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>&) {
     // el ataque especial es una rafaga rapida de 3 tiros a un enemigo
     float specialElapsed = specialClock.getElapsedTime().asSeconds();
     if (!burstActive && specialElapsed >= specialCooldown) {
-        float roll = static_cast<float>(rand()) / RAND_MAX;
+        float roll = rollSpecial();
         if (roll <= specialChance) {
-            std::cout << "Archer fires a burst attack\n";
+            GK_LOG_DEBUG("Archer fires a burst attack");
             burstActive = true;
             burstShotsFired = 0;
             burstClock.restart();
@@ -65,17 +46,11 @@ void Archer::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>&) {
     // ejecutar ráfaga si está activa
     if (burstActive && burstShotsFired < totalBurstShots) {
         if (burstClock.getElapsedTime().asSeconds() >= burstInterval) {
-            std::cout << "Burst shot " << (burstShotsFired + 1) << " hits for " << damage*0.8 << " damage.\n";
-            enemy.takeDamage(damage*0.8, "arrow");
-
-            // sonido de flecha
-            if (audioSystem) {
-                audioSystem->playSound("arrow");
-            }
+            GK_LOG_DEBUG("Burst shot {} hits for {} damage.", burstShotsFired + 1, damage*0.8);
+            enemy.takeDamage(damage*0.8, DamageType::Arrow);
 
             // Crear flecha
-            Arrow arrow(arrowTexture, sprite.getPosition(), enemy.getPosition());
-            activeArrows.push_back(arrow);
+            notifyShot(enemy, true);
 
             burstShotsFired++;
             burstClock.restart();
@@ -88,6 +63,11 @@ void Archer::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>&) {
     }
 }
 
+void Archer::setClock(const SimClock* clock) {
+    Tower::setClock(clock);
+    burstClock.setClock(clock);
+}
+
 int Archer::getUpgradeCost() const {
     return 60 + (level * 40);
 }
@@ -99,30 +79,8 @@ void Archer::upgrade() {
         range += 25.0f;
         attackSpeed += 0.15f;
 
-        if (audioSystem) {
-            audioSystem->playSound("upgrade");
-        }
-
-        recentlyUpgraded = true;
-        upgradeFlashClock.restart();
-
-        std::cout << "Archer upgraded to level " << level << "\n";
-    }
-}
-
-void Archer::updateProjectiles(float dt) {
-    for (auto it = activeArrows.begin(); it != activeArrows.end(); ) {
-        it->update(dt);
-        if (it->hasReachedTarget()) {
-            it = activeArrows.erase(it); // eliminar flechas que ya llegaron
-        } else {
-            ++it;
-        }
-    }
-}
+        notifyUpgrade();
 
-void Archer::drawProjectiles(sf::RenderWindow& window) {
-    for (const auto& arrow : activeArrows) {
-        arrow.draw(window);
+        GK_LOG_INFO("Archer upgraded to level {}", level);
     }
 }
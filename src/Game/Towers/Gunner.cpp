@@ -4,44 +4,25 @@
 
 #include "Game/Towers/Gunner.h"
 
-#include "Effects/Cannonball.h"
 #include "Game/Enemies/Enemy.h"
-#include "Core/AudioSystem.h"
+#include "Game/Systems/Logger.h"
 
 Gunner::Gunner() : Tower(
+    TowerType::Gunner, // type
     180, // cost
     100, // damage
     160.0f, // range
     0.8f, // attack speed
     9.0f // special cooldown
     ) {
-    texture.loadFromFile("assets/images/towers/Gunner.png");
-    sprite.setTexture(texture);
-
-    bulletTexture.loadFromFile("assets/images/towers/Cannonball.png");
-
-    // Centrar el origen del sprite
-    sf::FloatRect bounds = sprite.getLocalBounds();
-    sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-
-    // Escalar el sprite (ajusta el tamaño a tu celda)
-    float scaleFactor = 60.f / bounds.width; // Asumiendo que la celda mide 40x40 px
-    sprite.setScale(scaleFactor, scaleFactor);
 }
 
 void Gunner::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>&) {
     float elapsed = attackClock.getElapsedTime().asSeconds();
     if (elapsed >= 1.0f / attackSpeed) {
-        enemy.takeDamage(damage, "artillery");
+        enemy.takeDamage(damage, DamageType::Artillery);
 
-        // sonido de bala
-        if (audioSystem) {
-            audioSystem->playSound("cannonball");
-        }
-
-        Cannonball bullet(bulletTexture, sprite.getPosition(), enemy.getPosition());
-        bullet.setScale(0.02f); // más pequeño que fireball
-        activeBullets.push_back(bullet);
+        notifyShot(enemy, false);
 
         attackClock.restart(); // reinicia el temporizador
     }
@@ -49,21 +30,14 @@ void Gunner::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>&) {
     // ataque especial de alto daño
     float specialElapsed = specialClock.getElapsedTime().asSeconds();
     if (specialElapsed >= specialCooldown) {
-        float roll = static_cast<float>(rand()) / RAND_MAX;
+        float roll = rollSpecial();
         if (roll <= specialChance) {
             float specialDamage = damage * 2.0f;
-            std::cout << "Gunner fires big damage shot causing " << specialDamage << " damage\n";
-
-            // sonido de bala
-            if (audioSystem) {
-                audioSystem->playSound("cannonball");
-            }
+            GK_LOG_DEBUG("Gunner fires big damage shot causing {} damage", specialDamage);
 
-            Cannonball specialBullet(bulletTexture, sprite.getPosition(), enemy.getPosition());
-            specialBullet.setScale(0.06f); // más pequeño que fireball
-            activeBullets.push_back(specialBullet);
+            notifyShot(enemy, true);
 
-            enemy.takeDamage(specialDamage, "artillery");
+            enemy.takeDamage(specialDamage, DamageType::Artillery);
         }
         specialClock.restart();
     }
@@ -81,30 +55,8 @@ void Gunner::upgrade() {
         attackSpeed += 0.08f;     // mejora mínima en cadencia
         specialChance += 0.08f;   // aumenta probabilidad de especial
 
-        if (audioSystem) {
-            audioSystem->playSound("upgrade");
-        }
-
-        recentlyUpgraded = true;
-        upgradeFlashClock.restart();
+        notifyUpgrade();
 
-        std::cout << "Gunner upgraded to level " << level << "\n";
+        GK_LOG_INFO("Gunner upgraded to level {}", level);
     }
 }
-
-void Gunner::updateProjectiles(float dt) {
-    for (auto it = activeBullets.begin(); it != activeBullets.end(); ) {
-        it->update(dt);
-        if (it->hasReachedTarget()) {
-            it = activeBullets.erase(it);
-        } else {
-            ++it;
-        }
-    }
-}
-
-void Gunner::drawProjectiles(sf::RenderWindow& window) {
-    for (const auto& bullet : activeBullets) {
-        bullet.draw(window);
-    }
-}
\ No newline at end of file
@@ -4,27 +4,16 @@
 
 #include "Game/Towers/Mage.h"
 #include "Game/Enemies/Enemy.h"
-#include "Core/AudioSystem.h"
+#include "Game/Systems/Logger.h"
 
 Mage::Mage() : Tower(
+    TowerType::Mage, // type
     150, // cost
     45, // damage
     200.0f, // range
     1.2f, // attack speed
     7.0f // special cooldown
     ) {
-    texture.loadFromFile("assets/images/towers/Mage.png");
-    sprite.setTexture(texture);
-
-    fireballTexture.loadFromFile("assets/images/towers/Fireball.png");
-
-    // Centrar el origen del sprite
-    sf::FloatRect bounds = sprite.getLocalBounds();
-    sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-
-    // Escalar el sprite (ajusta el tamaño a tu celda)
-    float scaleFactor = 60.f / bounds.width; // Asumiendo que la celda mide 40x40 px
-    sprite.setScale(scaleFactor, scaleFactor);
 }
 
 void Mage::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>& allEnemies) {
@@ -32,16 +21,10 @@ void Mage::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>& allE
 
     // ataque normal
     if (elapsed >= 1.0f / attackSpeed) {
-        enemy.takeDamage(damage, "magic");
-
-        //  sonido de fireball
-        if (audioSystem) {
-            audioSystem->playSound("fireball");
-        }
+        enemy.takeDamage(damage, DamageType::Magic);
 
         // Animacion de bola de fuego
-        Fireball fb(fireballTexture, sprite.getPosition(), enemy.getPosition());
-        activeFireballs.push_back(fb);
+        notifyShot(enemy, false);
 
         attackClock.restart();
     }
@@ -50,38 +33,45 @@ void Mage::attack(Enemy& enemy, const DynamicArray<std::unique_ptr<Enemy>>& allE
     // el ataque especial hace dano en area
     float specialElapsed = specialClock.getElapsedTime().asSeconds();
     if (specialElapsed >= specialCooldown) {
-        float roll = static_cast<float>(rand()) / RAND_MAX;
+        float roll = rollSpecial();
         if (roll <= specialChance) {
-            std::cout << "Mage fires an area explosion\n";
+            GK_LOG_DEBUG("Mage fires an area explosion");
             float aoeRadius = 200.0f;
             float extraDamage = damage * 1.5f;
 
-            //  sonido de fireball
-            if (audioSystem) {
-                audioSystem->playSound("fireball");
-            }
-
             // Crear animación especial de bola de fuego grande
-            Fireball specialFb(fireballTexture, sprite.getPosition(), enemy.getPosition());
-            specialFb.setScale(0.2f); // más grande
-            activeFireballs.push_back(specialFb);
+            notifyShot(enemy, true);
 
             // daño fuerte al objetivo principal
-            enemy.takeDamage(extraDamage, "magic");
-
-            // daño en área a enemigos cercanos
-            for (const auto& other : allEnemies) {
-                if (other.get() == &enemy || !other->isAlive()) continue;
-
-                float dx = other->getPosition().x - enemy.getPosition().x;
-                float dy = other->getPosition().y - enemy.getPosition().y;
-                float dist = std::hypot(dx, dy);
-
-                if (dist <= aoeRadius) {
-                    std::cout << "Explosion hits nearby enemy for " << damage << " damage.\n";
-                    other->takeDamage(damage*1.2, "magic");
+            enemy.takeDamage(extraDamage, DamageType::Magic);
+
+            // daño en área a enemigos cercanos, usando el indice espacial si corresponde a esta lista
+            float splashDamage = damage * 1.2;
+            areaHits.clear();
+            if (enemyIndex && enemyIndex->size() == allEnemies.size()) {
+                enemyIndex->queryRange(enemy.getPosition(), aoeRadius, nearbyEnemies);
+                for (int index : nearbyEnemies) {
+                    Enemy* other = allEnemies[index].get();
+                    if (other == &enemy || !other->isAlive()) continue;
+
+                    GK_LOG_DEBUG("Explosion hits nearby enemy for {} damage.", damage);
+                    areaHits.push_back({other, splashDamage, DamageType::Magic});
+                }
+            } else {
+                for (const auto& other : allEnemies) {
+                    if (other.get() == &enemy || !other->isAlive()) continue;
+
+                    float dx = other->getPosition().x - enemy.getPosition().x;
+                    float dy = other->getPosition().y - enemy.getPosition().y;
+                    float dist = std::hypot(dx, dy);
+
+                    if (dist <= aoeRadius) {
+                        GK_LOG_DEBUG("Explosion hits nearby enemy for {} damage.", damage);
+                        areaHits.push_back({other.get(), splashDamage, DamageType::Magic});
+                    }
                 }
             }
+            Enemy::applyDamage(areaHits);
         }
         specialClock.restart();
     }
@@ -99,30 +89,8 @@ void Mage::upgrade() {
         attackSpeed += 0.12f;    // mejora ligera en velocidad
         specialCooldown -= 0.2f; // ataque especial más frecuente
 
-        if (audioSystem) {
-            audioSystem->playSound("upgrade");
-        }
-
-        recentlyUpgraded = true;
-        upgradeFlashClock.restart();
+        notifyUpgrade();
 
-        std::cout << "Mage upgraded to level " << level << "\n";
+        GK_LOG_INFO("Mage upgraded to level {}", level);
     }
 }
-
-void Mage::updateProjectiles(float dt) {
-    for (auto it = activeFireballs.begin(); it != activeFireballs.end(); ) {
-        it->update(dt);
-        if (it->hasReachedTarget()) {
-            it = activeFireballs.erase(it); // eliminar fireballs que ya impactaron
-        } else {
-            ++it;
-        }
-    }
-}
-
-void Mage::drawProjectiles(sf::RenderWindow& window) {
-    for (const auto& fireball : activeFireballs) {
-        fireball.draw(window);
-    }
-}
\ No newline at end of file
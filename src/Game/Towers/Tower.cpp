@@ -1,7 +1,18 @@
 #include "Game/Towers/Tower.h"
+#include "Game/Enemies/Enemy.h"
 
-Tower::Tower(int cost, int damage, float range, float attackSpeed, float specialCooldown)
-    : cost(cost), damage(damage), range(range), attackSpeed(attackSpeed), specialCooldown(specialCooldown) {}
+// nombre legible del tipo de torre, solo para registro y distribuciones
+const char* towerTypeName(TowerType type) {
+    switch (type) {
+        case TowerType::Archer: return "Archer";
+        case TowerType::Mage: return "Mage";
+        case TowerType::Gunner: return "Gunner";
+    }
+    return "Tower";
+}
+
+Tower::Tower(TowerType towerType, int cost, int damage, float range, float attackSpeed, float specialCooldown)
+    : towerType(towerType), cost(cost), damage(damage), range(range), attackSpeed(attackSpeed), specialCooldown(specialCooldown) {}
 
 float Tower::getRange() const {
     return range;
@@ -20,21 +31,58 @@ int Tower::getLevel() const {
 }
 
 void Tower::setPosition(const sf::Vector2f& pos) {
-    sprite.setPosition(pos);
+    position = pos;
+}
+
+sf::Vector2f Tower::getPosition() const {
+    return position;
+}
+
+void Tower::setEventQueue(SimulationEventQueue* queue) {
+    events = queue;
 }
 
-const sf::Sprite& Tower::getSprite() const {
-    return sprite;
+// asigna el reloj de la simulacion y reinicia los temporizadores de ataque
+void Tower::setClock(const SimClock* clock) {
+    attackClock.setClock(clock);
+    specialClock.setClock(clock);
 }
 
-void Tower::setSharedFont(const sf::Font& font) {
-    sharedFont = font;
+void Tower::setRandomStream(RandomStream* stream) {
+    random = stream;
 }
 
-const sf::Font& Tower::getFont() const {
-    return sharedFont;
+// asigna el indice espacial de enemigos del paso actual
+void Tower::setEnemyIndex(const SpatialHash* index) {
+    enemyIndex = index;
 }
 
-void Tower::setAudioSystem(AudioSystem* audio) {
-    audioSystem = audio;
+// tirada para el ataque especial, sin flujo asignado nunca se activa
+float Tower::rollSpecial() {
+    return random ? random->nextFloat() : 1.0f;
+}
+
+// avisa a la capa visual que la torre disparo (sonido y proyectil)
+void Tower::notifyShot(const Enemy& enemy, bool special) {
+    if (!events) return;
+
+    SimulationEvent event;
+    event.type = SimulationEventType::TowerFired;
+    event.enemyId = enemy.getId();
+    event.tower = this;
+    event.position = position;
+    event.target = enemy.getPosition();
+    event.special = special;
+    events->push_back(event);
+}
+
+// avisa a la capa visual que la torre subio de nivel
+void Tower::notifyUpgrade() {
+    if (!events) return;
+
+    SimulationEvent event;
+    event.type = SimulationEventType::TowerUpgraded;
+    event.tower = this;
+    event.position = position;
+    events->push_back(event);
 }
@@ -0,0 +1,154 @@
+#include "../include/Render/EnemyRenderer.h"
+#include <iostream>
+#include <cstdlib>
+
+// configura las formas compartidas de la barra de vida
+EnemyRenderer::EnemyRenderer() : font(nullptr), random(RandomService::timeSeed()) {
+    healthBarBorder.setSize(sf::Vector2f(40.f, 5.f));
+    healthBarBorder.setFillColor(sf::Color::Transparent);
+    healthBarBorder.setOutlineColor(sf::Color::Black);
+    healthBarBorder.setOutlineThickness(1.f);
+}
+
+
+
+// toma del cache la textura de cada tipo de enemigo, compartida por todas las instancias
+bool EnemyRenderer::loadTextures(TextureCache& textures) {
+    bool success = textures.load("assets/images/enemies/ogre.png");
+    success = textures.load("assets/images/enemies/DarkElve.png") && success;
+    success = textures.load("assets/images/enemies/Harpy.png") && success;
+    success = textures.load("assets/images/enemies/Mercenary.png") && success;
+
+    ogreTexture = &textures.get("assets/images/enemies/ogre.png");
+    darkElfTexture = &textures.get("assets/images/enemies/DarkElve.png");
+    harpyTexture = &textures.get("assets/images/enemies/Harpy.png");
+    mercenaryTexture = &textures.get("assets/images/enemies/Mercenary.png");
+    return success;
+}
+
+
+
+// establece la fuente de los textos de daño
+void EnemyRenderer::setFont(const sf::Font& font) {
+    this->font = &font;
+}
+
+
+
+// crea textos flotantes a partir de los eventos de daño
+void EnemyRenderer::handleEvent(const SimulationEvent& event) {
+    if (event.type == SimulationEventType::EnemyDamaged) {
+        createDamageText(event.position, event.amount);
+    }
+}
+
+
+
+// crea un texto flotante que muestra el daño recibido
+void EnemyRenderer::createDamageText(const sf::Vector2f& position, float damage) {
+    if (!font) return;
+
+    FloatingDamageText damageText;
+    damageText.text.setFont(*font);
+    damageText.text.setCharacterSize(16);
+    damageText.text.setFillColor(sf::Color::Red);
+    damageText.text.setString("-" + std::to_string(static_cast<int>(damage)));
+
+    // centrar el texto
+    sf::FloatRect bounds = damageText.text.getLocalBounds();
+    damageText.text.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+
+    // posicionar encima del enemigo con variacion aleatoria
+    float offsetX = random.range(-10.0f, 10.0f);
+    damageText.text.setPosition(position.x + offsetX, position.y - 60.f);
+
+    floatingTexts.push_back(damageText);
+}
+
+
+
+// actualiza la animacion de los textos de daño flotantes
+// anima y descarta en una sola pasada, sin desplazar la lista por cada texto vencido
+void EnemyRenderer::update(float dt) {
+    floatingTexts.erase_if([dt](FloatingDamageText& floating) {
+        float t = floating.timer.getElapsedTime().asSeconds();
+
+        // eliminar texto despues de 0.8 segundos
+        if (t > 0.8f) {
+            return true;
+        }
+
+        // mover el texto hacia arriba
+        sf::Vector2f pos = floating.text.getPosition();
+        pos.y -= 20.f * dt;
+        floating.text.setPosition(pos);
+
+        // aplicar efecto de desvanecimiento gradual
+        sf::Color color = floating.text.getFillColor();
+        color.a = static_cast<sf::Uint8>(255 * (1.0f - t / 0.8f));
+        floating.text.setFillColor(color);
+
+        return false;
+    });
+}
+
+
+
+// dibuja todos los enemigos y los numeros de daño
+void EnemyRenderer::draw(sf::RenderWindow& window, const DynamicArray<std::unique_ptr<Enemy>>& enemies) {
+    for (const auto& enemy : enemies) {
+        if (enemy->isAlive()) {
+            drawEnemy(window, *enemy);
+        }
+    }
+
+    // dibujar numeros flotantes que muestran el daño recibido
+    for (const auto& dmgText : floatingTexts) {
+        window.draw(dmgText.text);
+    }
+}
+
+
+
+// dibuja el sprite y la barra de vida de un enemigo
+void EnemyRenderer::drawEnemy(sf::RenderWindow& window, const Enemy& enemy) {
+    // elegir textura y escala segun el tipo de enemigo
+    const sf::Texture* texture = ogreTexture;
+    float scale = 0.4f;
+    switch (enemy.getType()) {
+        case EnemyType::Ogre:      texture = ogreTexture;      scale = 0.4f;  break;
+        case EnemyType::DarkElf:   texture = darkElfTexture;   scale = 0.13f; break;
+        case EnemyType::Harpy:     texture = harpyTexture;     scale = 0.15f; break;
+        case EnemyType::Mercenary: texture = mercenaryTexture; scale = 0.13f; break;
+    }
+
+    // centrar el origen del sprite para rotaciones correctas
+    sprite.setTexture(*texture, true);
+    sf::FloatRect bounds = sprite.getLocalBounds();
+    sprite.setOrigin(bounds.width / 2, bounds.height / 2);
+    sprite.setScale(scale, scale);
+
+    sf::Vector2f position = enemy.getPosition();
+    sprite.setPosition(position);
+    window.draw(sprite);
+
+    // dibujar barra de vida con color segun porcentaje de salud
+    float healthPercentage = enemy.getHealthPercentage();
+    healthBar.setSize(sf::Vector2f(40.f * healthPercentage, 5.f));
+
+    // cambiar color segun porcentaje de vida
+    if (healthPercentage > 0.6f) {
+        healthBar.setFillColor(sf::Color::Green);
+    } else if (healthPercentage > 0.3f) {
+        healthBar.setFillColor(sf::Color::Yellow);
+    } else {
+        healthBar.setFillColor(sf::Color::Red);
+    }
+
+    healthBar.setPosition(position.x - 20.f, position.y - 50.f);
+    window.draw(healthBar);
+
+    // dibujar borde negro alrededor de la barra de vida
+    healthBarBorder.setPosition(position.x - 20.f, position.y - 50.f);
+    window.draw(healthBarBorder);
+}
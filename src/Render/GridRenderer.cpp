@@ -0,0 +1,153 @@
+#include "../include/Render/GridRenderer.h"
+#include "Game/Towers/Tower.h"
+#include <iostream>
+
+// inicializa las formas reutilizadas para dibujar cada celda
+GridRenderer::GridRenderer()
+    : groundTexture1(nullptr), groundTexture2(nullptr), archerTexture(nullptr),
+      mageTexture(nullptr), gunnerTexture(nullptr), texturesLoaded(false) {
+    backgroundShape.setFillColor(sf::Color::White);
+    borderShape.setFillColor(sf::Color::Transparent);
+}
+
+
+
+// toma del cache las texturas del suelo y de las torres
+bool GridRenderer::loadTextures(TextureCache& textures) {
+    bool success = textures.load("assets/images/grid/suelo1.png");
+    success = textures.load("assets/images/grid/suelo2.png") && success;
+    groundTexture1 = &textures.get("assets/images/grid/suelo1.png");
+    groundTexture2 = &textures.get("assets/images/grid/suelo2.png");
+
+    texturesLoaded = success;
+
+    // texturas de las torres compartidas por todas las instancias
+    archerTexture = &textures.get("assets/images/towers/Archer.png");
+    mageTexture = &textures.get("assets/images/towers/Mage.png");
+    gunnerTexture = &textures.get("assets/images/towers/Gunner.png");
+
+    return success;
+}
+
+
+
+// registra las mejoras de torres para mostrar el parpadeo del nivel
+void GridRenderer::handleEvent(const SimulationEvent& event) {
+    if (event.type == SimulationEventType::TowerUpgraded && event.tower) {
+        upgradeFlashes[event.tower].restart();
+    }
+}
+
+
+
+// dibuja todas las celdas y las torres de la cuadricula
+void GridRenderer::draw(sf::RenderWindow& window, const Grid& grid, const sf::Font& font) {
+    const auto& cells = grid.getCells();
+
+    for (int i = 0; i < grid.getRows(); i++) {
+        for (int j = 0; j < grid.getCols(); j++) {
+            drawCell(window, cells[i][j], (i + j) % 2 == 0);
+        }
+    }
+
+    // las torres salen del registro de la cuadricula, sin revisar cada celda
+    for (const auto& placed : grid.getTowers()) {
+        drawTower(window, *placed.cell, font);
+    }
+}
+
+
+
+// dibuja el fondo y el borde de una celda
+void GridRenderer::drawCell(sf::RenderWindow& window, const Cell& cell, bool useTexture1) {
+    sf::Vector2f size(cell.getSize(), cell.getSize());
+
+    // dibujar el fondo de la celda
+    if (texturesLoaded) {
+        const sf::Texture& texture = useTexture1 ? *groundTexture1 : *groundTexture2;
+        backgroundShape.setPosition(cell.getPosition());
+        backgroundShape.setSize(size);
+        backgroundShape.setTexture(&texture);
+        backgroundShape.setTextureRect(sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y));
+        window.draw(backgroundShape);
+    }
+
+    // dibujar el borde de la celda segun si esta seleccionada
+    borderShape.setPosition(cell.getPosition());
+    borderShape.setSize(size);
+    if (cell.isSelected()) {
+        borderShape.setOutlineColor(sf::Color::White);
+        borderShape.setOutlineThickness(2.0f);
+    } else {
+        borderShape.setOutlineColor(sf::Color(100, 100, 100));
+        borderShape.setOutlineThickness(1.0f);
+    }
+    window.draw(borderShape);
+}
+
+
+
+// dibuja la torre de una celda junto con su nivel
+void GridRenderer::drawTower(sf::RenderWindow& window, const Cell& cell, const sf::Font& font) {
+    const auto tower = cell.getTower();
+    const sf::Texture& texture = getTowerTexture(*tower);
+
+    // centrar y escalar el sprite al tamaño de la celda
+    towerSprite.setTexture(texture, true);
+    sf::FloatRect bounds = towerSprite.getLocalBounds();
+    towerSprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+    if (bounds.width > 0.f) {
+        float scaleFactor = 60.f / bounds.width;
+        towerSprite.setScale(scaleFactor, scaleFactor);
+    }
+    towerSprite.setPosition(cell.getCenter());
+    window.draw(towerSprite);
+
+    // Protección extra
+    if (font.getInfo().family.empty()) return;
+
+    sf::Text levelText;
+    levelText.setFont(font);
+    levelText.setCharacterSize(14);
+
+    // Color según el nivel
+    switch (tower->getLevel()) {
+        case 1: levelText.setFillColor(sf::Color::White); break;
+        case 2: levelText.setFillColor(sf::Color::Magenta); break;
+        case 3: levelText.setFillColor(sf::Color::Red); break;
+        default: levelText.setFillColor(sf::Color::White); break; // fallback para nivel no esperado
+    }
+
+    levelText.setString("Lv." + std::to_string(tower->getLevel()));
+
+    sf::FloatRect textBounds = levelText.getLocalBounds();
+    levelText.setOrigin(textBounds.width / 2.f, 0.f);
+    levelText.setPosition((cell.getPosition().x + 35.0f), cell.getPosition().y + 50.f);
+
+    auto flash = upgradeFlashes.find(tower.get());
+    if (flash != upgradeFlashes.end()) {
+        float t = flash->second.getElapsedTime().asSeconds();
+
+        if (t > 1.0f) {
+            upgradeFlashes.erase(flash); // termina el parpadeo
+        } else {
+            if (static_cast<int>(t * 5) % 2 == 0) {
+                window.draw(levelText); // parpadeo cada 0.2s
+            }
+            return; // evita que se dibuje doble
+        }
+    }
+
+    window.draw(levelText); // dibujo normal si no está parpadeando
+}
+
+
+
+// elige la textura segun el tipo de torre
+const sf::Texture& GridRenderer::getTowerTexture(const Tower& tower) const {
+    switch (tower.getType()) {
+        case TowerType::Mage: return *mageTexture;
+        case TowerType::Gunner: return *gunnerTexture;
+        default: return *archerTexture;
+    }
+}
@@ -0,0 +1,86 @@
+#include "../include/Render/ProjectileRenderer.h"
+#include "Game/Towers/Tower.h"
+#include <algorithm>
+
+// toma del cache las texturas de los proyectiles
+bool ProjectileRenderer::loadTextures(TextureCache& textures) {
+    bool success = textures.load("assets/images/towers/Arrow.png");
+    success = textures.load("assets/images/towers/Fireball.png") && success;
+    success = textures.load("assets/images/towers/Cannonball.png") && success;
+
+    arrowTexture = &textures.get("assets/images/towers/Arrow.png");
+    fireballTexture = &textures.get("assets/images/towers/Fireball.png");
+    cannonballTexture = &textures.get("assets/images/towers/Cannonball.png");
+    return success;
+}
+
+
+
+// crea el proyectil correspondiente a cada disparo de torre
+void ProjectileRenderer::handleEvent(const SimulationEvent& event) {
+    if (event.type != SimulationEventType::TowerFired || !event.tower) {
+        return;
+    }
+
+    switch (event.tower->getType()) {
+        case TowerType::Archer:
+            activeArrows.emplace_back(*arrowTexture, event.position, event.target);
+            break;
+        case TowerType::Mage: {
+            Fireball fb(*fireballTexture, event.position, event.target);
+            if (event.special) {
+                fb.setScale(0.2f); // más grande
+            }
+            activeFireballs.push_back(fb);
+            break;
+        }
+        case TowerType::Gunner: {
+            Cannonball bullet(*cannonballTexture, event.position, event.target);
+            bullet.setScale(event.special ? 0.06f : 0.02f); // más pequeño que fireball
+            activeBullets.push_back(bullet);
+            break;
+        }
+    }
+}
+
+
+
+// mueve los proyectiles y elimina los que ya llegaron
+// la limpieza compacta cada lista en una sola pasada, una explosion con muchos impactos no desplaza la lista por cada uno
+void ProjectileRenderer::update(float dt) {
+    for (auto& arrow : activeArrows) {
+        arrow.update(dt);
+    }
+    for (auto& fireball : activeFireballs) {
+        fireball.update(dt);
+    }
+    for (auto& bullet : activeBullets) {
+        bullet.update(dt);
+    }
+
+    // eliminar flechas, fireballs y balas que ya impactaron
+    activeArrows.erase(std::remove_if(activeArrows.begin(), activeArrows.end(),
+                                      [](const Arrow& arrow) { return arrow.hasReachedTarget(); }),
+                       activeArrows.end());
+    activeFireballs.erase(std::remove_if(activeFireballs.begin(), activeFireballs.end(),
+                                         [](const Fireball& fireball) { return fireball.hasReachedTarget(); }),
+                          activeFireballs.end());
+    activeBullets.erase(std::remove_if(activeBullets.begin(), activeBullets.end(),
+                                       [](const Cannonball& bullet) { return bullet.hasReachedTarget(); }),
+                        activeBullets.end());
+}
+
+
+
+// dibuja todos los proyectiles activos
+void ProjectileRenderer::draw(sf::RenderWindow& window) {
+    for (const auto& arrow : activeArrows) {
+        arrow.draw(window);
+    }
+    for (const auto& fireball : activeFireballs) {
+        fireball.draw(window);
+    }
+    for (const auto& bullet : activeBullets) {
+        bullet.draw(window);
+    }
+}
@@ -8,13 +8,8 @@
 #include "Game/Towers/Archer.h"
 #include "Game/Towers/Mage.h"
 #include "Game/Towers/Gunner.h"
-#include "../include/Game/Systems/Pathfinding.h"
-#include "Game/Enemies/Ogre.h"
-#include "Game/Enemies/DarkElves.h"
-#include "Game/Enemies/Harpy.h"
-#include "Game/Enemies/Mercenary.h"
-#include "../include/Game/Genetics/Genetics.h"
 #include "../include/UI/StatsPanel.h"
+#include "../include/Game/Systems/Logger.h"
 
 // inicializa el estado de juego con valores por defecto
 GameplayState::GameplayState()
@@ -54,13 +49,19 @@ void GameplayState::init() {
     // configurar imagen de fondo
     loadBackgroundTexture();
 
-    // crear cuadricula centrada en pantalla
+    // crear simulacion con la cuadricula centrada en pantalla
     float gridX = (window.getSize().x - GRID_COLS * CELL_SIZE) / 2;
     float gridY = (window.getSize().y - GRID_ROWS * CELL_SIZE) / 2;
-    gameGrid = std::make_unique<Grid>(gridX, gridY, GRID_ROWS, GRID_COLS, CELL_SIZE);
+    uint64_t seed = RandomService::timeSeed();
+    std::cout << "Semilla de la partida: " << seed << "\n";
+    simulation = std::make_unique<Simulation>(gridX, gridY, GRID_ROWS, GRID_COLS, CELL_SIZE, 20, 0.25f, 0.85f, 1.5f, seed);
+    gameGrid = &simulation->getGrid();
 
-    // definir puntos de entrada y salida de enemigos
-    initializeSpawnAndGoalPoints();
+    // cargar recursos visuales compartidos por todas las entidades
+    gridRenderer.loadTextures(game->getTextureCache());
+    enemyRenderer.loadTextures(game->getTextureCache());
+    enemyRenderer.setFont(game->getFont());
+    projectileRenderer.loadTextures(game->getTextureCache());
 
     // configurar mensaje de oro insuficiente
     insufficientGoldText.setFont(game->getFont());
@@ -84,45 +85,8 @@ void GameplayState::init() {
         game->getWindow().getSize().y - pathTextBounds.height - 250.f
     );
 
-    // configurar fuente compartida para torres
-    Tower::setSharedFont(game->getFont());
-
-    // configurar sistema de audio para torres
-    Tower::setAudioSystem(&game->getAudioSystem());
-
-    // configurar fuente compartida para enemigos
-    Enemy::setSharedFont(game->getFont());
-
-    // configurar sistema de audio para enemigos
-    Enemy::setAudioSystem(&game->getAudioSystem());
-
-    // inicializar algoritmo genetico con parametros optimizados
-    geneticsSystem = std::make_unique<Genetics>(20, 0.25f, 0.85f);
-
-    // calcular camino inicial para establecer longitud de referencia
-    auto initialPath = Pathfinding::findPath(gameGrid.get(), spawnPoint, goalPoint);
-
-    // inicializar gestor de oleadas con parametros base
-    waveManager = std::make_unique<WaveManager>(initialPath, gameGrid.get(), goalPoint, 1.5f);
-
-    // establecer longitud del camino en ambos sistemas para calculos de fitness
-    if (!initialPath.empty()) {
-        float pathLength = 0.0f;
-        for (size_t i = 0; i < initialPath.size() - 1; i++) {
-            sf::Vector2f segment = initialPath[i+1] - initialPath[i];
-            pathLength += std::sqrt(segment.x * segment.x + segment.y * segment.y);
-        }
-        waveManager->setPathTotalLength(pathLength);
-        geneticsSystem->setPathTotalLength(pathLength);
-        std::cout << "Longitud del camino establecida: " << pathLength << "\n";
-    }
-
-    // obtener cromosomas para la primera oleada
-    DynamicArray<Chromosome> firstWaveChromosomes = geneticsSystem->getChromosomesForWave(1);
-    waveManager->setWaveChromosomes(firstWaveChromosomes);
-
     // comenzar inmediatamente la primera oleada
-    waveManager->startNextWave();
+    simulation->start();
 
     // crear panel de estadisticas para mostrar progreso genetico
     statsPanel = std::make_unique<StatsPanel>(game->getFont());
@@ -209,11 +173,13 @@ bool GameplayState::loadBackgroundTexture() {
     greenBackground.setSize(sf::Vector2f(window.getSize().x, window.getSize().y));
     greenBackground.setFillColor(sf::Color(34, 139, 34)); // verde bosque como respaldo
 
-    if (!backgroundTexture.loadFromFile("assets/images/backgrounds/backgroundGame.png")) {
+    auto& textures = game->getTextureCache();
+    if (!textures.load("assets/images/backgrounds/backgroundGame.png")) {
         std::cerr << "error: No se pudo cargar gameplay_background.png" << std::endl;
         backgroundLoaded = false;
         return false;
     }
+    const sf::Texture& backgroundTexture = textures.get("assets/images/backgrounds/backgroundGame.png");
 
     // ajustar sprite de fondo para cubrir toda la pantalla
     backgroundSprite.setTexture(backgroundTexture);
@@ -232,75 +198,18 @@ bool GameplayState::loadBackgroundTexture() {
 
 
 
-// define donde aparecen los enemigos y hacia donde se dirigen
-void GameplayState::initializeSpawnAndGoalPoints() {
-    float gridStartX = gameGrid->getX();
-    float gridStartY = gameGrid->getY();
-    int rows = gameGrid->getRows();
-    int cols = gameGrid->getCols();
-    float cellSize = gameGrid->getCellSize();
-
-    // usar fila central para el camino principal
-    int middleRow = rows / 2;
-
-    // punto de aparicion en el borde izquierdo
-    spawnPoint = sf::Vector2f(gridStartX - cellSize/2, gridStartY + middleRow * cellSize + cellSize/2);
-
-    // punto objetivo en el borde derecho
-    goalPoint = sf::Vector2f(gridStartX + (cols + 1) * cellSize + cellSize / 2, gridStartY + middleRow * cellSize + cellSize / 2);
-}
-
-
-
-// verifica si se puede colocar una torre sin bloquear caminos
-bool GameplayState::canPlaceTowerAt(Cell* cell) {
-    if (!cell || cell->hasTower()) {
-        return false;
-    }
-
-    // simular colocacion temporal para verificar impacto
-    cell->placeTower(std::make_shared<Archer>());
-
-    // verificar que sigue existiendo camino desde spawn hasta objetivo
-    bool hasPath = Pathfinding::hasValidPath(gameGrid.get(), spawnPoint, goalPoint);
-
-    // verificar que enemigos actuales pueden seguir llegando al objetivo
-    if (hasPath) {
-        for (const auto& enemy : enemies) {
-            if (enemy->isAlive()) {
-                auto enemyPath = Pathfinding::findPath(gameGrid.get(), enemy->getPosition(), goalPoint);
-                if (enemyPath.empty()) {
-                    hasPath = false;
-                    break;
-                }
-            }
-        }
-    }
-
-    // verificar que futuros enemigos tendran camino disponible
-    if (hasPath && waveManager->isWaveInProgress()) {
-        auto spawnPath = Pathfinding::findPath(gameGrid.get(), spawnPoint, goalPoint);
-        if (spawnPath.empty()) {
-            hasPath = false;
-        }
-    }
-
-    // remover torre temporal y devolver resultado
-    cell->placeTower(nullptr);
-    return hasPath;
-}
-
-
-
-// actualiza los caminos de todos los enemigos vivos
-void GameplayState::recalculateEnemyPaths() {
-    for (auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            auto newPath = Pathfinding::findPath(gameGrid.get(), enemy->getPosition(), goalPoint);
-            if (!newPath.empty()) {
-                enemy->setPath(newPath);
-            }
-        }
+// intenta colocar una torre en la celda seleccionada
+void GameplayState::placeTower(std::shared_ptr<Tower> tower) {
+    if (!simulation->canPlaceTowerAt(selectedCellForPlacement)) {
+        showPathBlocked = true;
+        pathBlockedClock.restart();
+    } else if (playerGold >= tower->getCost()) {
+        simulation->placeTower(selectedCellForPlacement, tower);
+        playerGold -= tower->getCost();
+        game->getAudioSystem().playSound("colocarTorre");
+    } else {
+        showGoldWarning = true;
+        goldWarningClock.restart();
     }
 }
 
@@ -346,10 +255,9 @@ void GameplayState::handleEvents(sf::Event& event) {
         if (event.key.code == sf::Keyboard::Escape) {
             auto pauseState = std::make_shared<PauseState>();
             game->pushState(pauseState);
-            recalculateEnemyPaths();
         }
         // forzar siguiente oleada con n (para pruebas)
-        else if (event.key.code == sf::Keyboard::N && !waveManager->isWaveInProgress()) {
+        else if (event.key.code == sf::Keyboard::N && !simulation->getWaveManager().isWaveInProgress()) {
             prepareNextGeneration();
         }
     }
@@ -403,21 +311,7 @@ void GameplayState::handleEvents(sf::Event& event) {
                 "ARCHER",
                 [this]() {
                     if (selectedCellForPlacement) {
-                        if (!canPlaceTowerAt(selectedCellForPlacement)) {
-                            showPathBlocked = true;
-                            pathBlockedClock.restart();
-                        } else {
-                            auto tower = std::make_shared<Archer>();
-                            if (playerGold >= tower->getCost()) {
-                                selectedCellForPlacement->placeTower(tower);
-                                playerGold -= tower->getCost();
-                                recalculateEnemyPaths();
-                                game->getAudioSystem().playSound("colocarTorre");
-                            } else {
-                                showGoldWarning = true;
-                                goldWarningClock.restart();
-                            }
-                        }
+                        placeTower(std::make_shared<Archer>());
                         selectedCellForPlacement = nullptr;
                         towerButtons.clear();
                         towerPriceTexts.clear();
@@ -428,6 +322,7 @@ void GameplayState::handleEvents(sf::Event& event) {
 
             // aplicar texturas de madera a los botones
             btnArcher->setTextures(
+                game->getTextureCache(),
                 "assets/images/buttons/wood_button_normal.png",
                 "assets/images/buttons/wood_button_selected.png"
             );
@@ -449,21 +344,7 @@ void GameplayState::handleEvents(sf::Event& event) {
                 "MAGE",
                 [this]() {
                     if (selectedCellForPlacement) {
-                        if (!canPlaceTowerAt(selectedCellForPlacement)) {
-                            showPathBlocked = true;
-                            pathBlockedClock.restart();
-                        } else {
-                            auto tower = std::make_shared<Mage>();
-                            if (playerGold >= tower->getCost()) {
-                                selectedCellForPlacement->placeTower(tower);
-                                playerGold -= tower->getCost();
-                                recalculateEnemyPaths();
-                                game->getAudioSystem().playSound("colocarTorre");
-                            } else {
-                                showGoldWarning = true;
-                                goldWarningClock.restart();
-                            }
-                        }
+                        placeTower(std::make_shared<Mage>());
                         selectedCellForPlacement = nullptr;
                         towerButtons.clear();
                         towerPriceTexts.clear();
@@ -474,6 +355,7 @@ void GameplayState::handleEvents(sf::Event& event) {
 
             // aplicar texturas de madera
             btnMage->setTextures(
+                game->getTextureCache(),
                 "assets/images/buttons/wood_button_normal.png",
                 "assets/images/buttons/wood_button_selected.png"
             );
@@ -495,21 +377,7 @@ void GameplayState::handleEvents(sf::Event& event) {
                 "GUNNER",
                 [this]() {
                     if (selectedCellForPlacement) {
-                        if (!canPlaceTowerAt(selectedCellForPlacement)) {
-                            showPathBlocked = true;
-                            pathBlockedClock.restart();
-                        } else {
-                            auto tower = std::make_shared<Gunner>();
-                            if (playerGold >= tower->getCost()) {
-                                selectedCellForPlacement->placeTower(tower);
-                                playerGold -= tower->getCost();
-                                recalculateEnemyPaths();
-                                game->getAudioSystem().playSound("colocarTorre");
-                            } else {
-                                showGoldWarning = true;
-                                goldWarningClock.restart();
-                            }
-                        }
+                        placeTower(std::make_shared<Gunner>());
                         selectedCellForPlacement = nullptr;
                         towerButtons.clear();
                         towerPriceTexts.clear();
@@ -520,6 +388,7 @@ void GameplayState::handleEvents(sf::Event& event) {
 
             // aplicar texturas de madera
             btnGunner->setTextures(
+                game->getTextureCache(),
                 "assets/images/buttons/wood_button_normal.png",
                 "assets/images/buttons/wood_button_selected.png"
             );
@@ -574,6 +443,7 @@ void GameplayState::handleEvents(sf::Event& event) {
 
                 // aplicar texturas de madera al boton de mejora
                 btnUpgrade->setTextures(
+                    game->getTextureCache(),
                     "assets/images/buttons/wood_button_normal.png",
                     "assets/images/buttons/wood_button_selected.png"
                 );
@@ -616,154 +486,107 @@ void GameplayState::update(float dt) {
         return;
     }
 
-    // obtener nuevos enemigos del gestor de oleadas
-    auto newEnemies = waveManager->update(dt);
+    // avanzar la simulacion y procesar lo ocurrido en este paso
+    simulation->step(dt);
+    handleSimulationEvents();
 
-    // mostrar debug cuando aparecen enemigos
-    if (!newEnemies.empty()) {
-        std::cout << "=== APARECIERON " << newEnemies.size() << " NUEVOS ENEMIGOS ===\n";
-    }
-
-    // agregar nuevos enemigos con sus caminos calculados
-    for (auto& enemy : newEnemies) {
-        // calcular ruta optima para el enemigo
-        auto path = Pathfinding::findPath(gameGrid.get(), enemy->getPosition(), goalPoint);
-        if (!path.empty()) {
-            enemy->setPath(path);
-        }
-        enemies.push_back(std::move(enemy));
-    }
+    // actualizar animaciones visuales
+    enemyRenderer.update(dt);
+    projectileRenderer.update(dt);
 
     // mostrar informacion de debug periodicamente
     static float debugTimer = 0;
     debugTimer += dt;
     if (debugTimer >= 2.0f) { // cada 2 segundos
-        std::cout << "Enemigos activos: " << enemies.size()
-                  << ", Oleada en progreso: " << (waveManager->isWaveInProgress() ? "SÍ" : "NO")
-                  << ", Enemigos spawneados: " << waveManager->getEnemiesSpawned()
-                  << ", Generación: " << geneticsSystem->getGeneration() << "\n";
+        std::cout << "Enemigos activos: " << simulation->getEnemies().size()
+                  << ", Oleada en progreso: " << (simulation->getWaveManager().isWaveInProgress() ? "SÍ" : "NO")
+                  << ", Enemigos spawneados: " << simulation->getWaveManager().getEnemiesSpawned()
+                  << ", Generación: " << simulation->getGenetics().getGeneration() << "\n";
         debugTimer = 0;
     }
 
-    // actualizar estados individuales de enemigos
-    updateEnemyStates(dt);
-
-    // procesar ataques de todas las torres
-    handleTowerAttacks(dt);
-
-    // verificar si es momento de preparar siguiente generacion
-    if (!gameOver) {
-        bool shouldPrepareNext = enemies.empty() && !waveManager->isWaveInProgress() && waveManager->getEnemiesSpawned() > 0;
+    // actualizar panel de estadisticas
+    updateStatsPanel();
+}
 
-        if (shouldPrepareNext) {
-            std::cout << "=== PREPARANDO SIGUIENTE GENERACIÓN ===\n";
-            std::cout << "Enemigos muertos: " << enemiesKilled << "\n";
 
-            prepareNextGeneration(); // calcular fitness y crear nueva generacion
 
-            // actualizar panel con nuevos datos
-            updateStatsPanel();
-        } else {
-            // actualizar panel durante la oleada
-            updateStatsPanel();
+// reparte los eventos de la simulacion entre audio, estadisticas y visuales
+void GameplayState::handleSimulationEvents() {
+    for (const auto& event : simulation->getEvents()) {
+        switch (event.type) {
+            case SimulationEventType::EnemyKilled:
+                processEnemyDeath(event);
+                break;
+            case SimulationEventType::EnemyReachedEnd:
+                processEnemyReachedEnd(event);
+                break;
+            case SimulationEventType::TowerFired:
+                if (event.tower) {
+                    switch (event.tower->getType()) {
+                        case TowerType::Archer: game->getAudioSystem().playSound("arrow"); break;
+                        case TowerType::Mage: game->getAudioSystem().playSound("fireball"); break;
+                        case TowerType::Gunner: game->getAudioSystem().playSound("cannonball"); break;
+                    }
+                }
+                break;
+            case SimulationEventType::TowerUpgraded:
+                game->getAudioSystem().playSound("upgrade");
+                break;
+            default:
+                break;
         }
 
-    } else {
-        // actualizar panel una vez mas al terminar el juego
-        updateStatsPanel();
+        gridRenderer.handleEvent(event);
+        enemyRenderer.handleEvent(event);
+        projectileRenderer.handleEvent(event);
     }
-}
 
-
-
-// actualiza el estado de todos los enemigos activos
-void GameplayState::updateEnemyStates(float dt) {
-    for (auto it = enemies.begin(); it != enemies.end();) {
-        (*it)->update(dt);
-
-        // verificar estado del enemigo
-        if (!(*it)->isAlive()) {
-            // procesar muerte y obtener recompensas
-            processEnemyDeath(*it);
-
-            // remover enemigo de la lista
-            size_t index = it - enemies.begin();
-            enemies.erase(index);
-            it = enemies.begin() + index;
-        }
-        else if ((*it)->hasReachedEnd()) {
-            // enemigo llego al final - terminar juego
-            processEnemyReachedEnd(*it);
-            ++it;
-        }
-        else {
-            ++it;
-        }
-    }
+    simulation->clearEvents();
 }
 
 
 
 // procesa la muerte de un enemigo y actualiza estadisticas
-void GameplayState::processEnemyDeath(std::unique_ptr<Enemy>& enemy) {
-    int id = enemy->getId();
+void GameplayState::processEnemyDeath(const SimulationEvent& event) {
+    int id = event.enemyId;
 
-    // mostrar informacion de debug sobre el enemigo muerto
-    std::cout << "=== ENEMIGO " << id << " MURIÓ ===\n";
-    std::cout << "Distancia: " << enemy->getTotalDistanceTraveled()
-              << ", Daño recibido: " << enemy->getTotalDamageReceived()
-              << ", Tiempo: " << enemy->getTimeAlive() << "\n";
+    GK_LOG_INFO("=== ENEMIGO {} MURIÓ ===", id);
 
     // detectar si inicio una nueva oleada y reiniciar contadores
-    int currentWave = waveManager->getCurrentWave();
+    int currentWave = simulation->getWaveManager().getCurrentWave();
     if (currentWave != currentWaveForStats) {
-        std::cout << "=== NUEVA OLEADA DETECTADA: " << currentWave << " (anterior: " << currentWaveForStats << ") ===\n";
+        GK_LOG_INFO("=== NUEVA OLEADA DETECTADA: {} (anterior: {}) ===", currentWave, currentWaveForStats);
         enemiesKilledThisWave = 0;
         currentWaveFitnessList.clear();
         currentWaveForStats = currentWave;
         statsPanel->resetForNewWave();
-        std::cout << "Panel de estadísticas reiniciado para nueva oleada\n";
+        GK_LOG_INFO("Panel de estadísticas reiniciado para nueva oleada");
     }
 
-    // registrar rendimiento en el gestor de oleadas
-    waveManager->trackEnemyDeath(id, *enemy);
-
     // reproducir sonido de muerte
     game->getAudioSystem().playSound("death");
 
     // otorgar recompensa de oro
-    playerGold += enemy->getGoldReward();
-    std::cout << "Gold + " << enemy->getGoldReward() << " (Total: " << playerGold << ")\n";
+    int goldReward = static_cast<int>(event.amount);
+    playerGold += goldReward;
+    GK_LOG_INFO("Gold + {} (Total: {})", goldReward, playerGold);
 
     // actualizar contadores de enemigos eliminados
     enemiesKilled++;
     enemiesKilledThisWave++;
 
-    // calcular fitness del enemigo muerto para estadisticas
-    Chromosome tempChromosome;
-    tempChromosome.calculateFitness(false, enemy->getTotalDistanceTraveled(),
-                                   enemy->getTotalDamageReceived(), enemy->getTimeAlive(),
-                                   1000.0f); // usar longitud del camino actual
-
-    currentWaveFitnessList.push_back(tempChromosome.getFitness());
+    // registrar fitness del enemigo muerto para estadisticas
+    currentWaveFitnessList.push_back(event.fitness);
 
-    std::cout << "Fitness del enemigo muerto: " << tempChromosome.getFitness() << "\n";
+    GK_LOG_DEBUG("Fitness del enemigo muerto: {}", event.fitness);
 }
 
 
 
 // procesa cuando un enemigo llega al final y termina el juego
-void GameplayState::processEnemyReachedEnd(std::unique_ptr<Enemy>& enemy) {
-    int id = enemy->getId();
-
-    std::cout << "=== ENEMIGO " << id << " LLEGÓ AL FINAL - GAME OVER ===\n";
-    std::cout << "Estadísticas finales - Distancia: " << enemy->getTotalDistanceTraveled()
-              << ", Daño recibido: " << enemy->getTotalDamageReceived()
-              << ", Tiempo vivo: " << enemy->getTimeAlive() << "s\n";
-
-    // registrar rendimiento antes de terminar el juego
-    waveManager->trackEnemyReachedEnd(id, *enemy);
-
+void GameplayState::processEnemyReachedEnd(const SimulationEvent& event) {
+    std::cout << "=== ENEMIGO " << event.enemyId << " LLEGÓ AL FINAL - GAME OVER ===\n";
     gameOver = true;
 }
 
@@ -771,12 +594,13 @@ void GameplayState::processEnemyReachedEnd(std::unique_ptr<Enemy>& enemy) {
 
 // actualiza la informacion mostrada en el panel de estadisticas
 void GameplayState::updateStatsPanel() {
+    const Genetics& genetics = simulation->getGenetics();
     statsPanel->update(
-        geneticsSystem->getGeneration(),
+        genetics.getGeneration(),
         enemiesKilledThisWave,
         currentWaveFitnessList,
-        geneticsSystem->getMutationRate(),
-        geneticsSystem->getMutationCount()
+        genetics.getMutationRate(),
+        genetics.getMutationCount()
     );
 
     if (gameOver) {
@@ -786,99 +610,11 @@ void GameplayState::updateStatsPanel() {
 
 
 
-// recolecta datos de rendimiento de enemigos que siguen vivos
-void GameplayState::collectEnemyPerformanceData() {
-    std::cout << "=== RECOLECTANDO DATOS DE ENEMIGOS ACTIVOS ===\n";
-
-    // actualizar informacion de enemigos que aun estan luchando
-    for (const auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            int id = enemy->getId();
-            std::cout << "Actualizando datos de enemigo activo " << id << "\n";
-
-            // registrar progreso actual de enemigos vivos
-            waveManager->trackEnemyPerformance(id, false,
-                                             enemy->getTotalDistanceTraveled(),
-                                             enemy->getTotalDamageReceived(),
-                                             enemy->getTimeAlive());
-        }
-    }
-}
-
-
-
-// genera la siguiente generacion usando algoritmo genetico
+// fuerza la siguiente generacion usando algoritmo genetico
 void GameplayState::prepareNextGeneration() {
-    std::cout << "=== INICIO prepareNextGeneration() ===\n";
-
-    // recopilar datos finales de enemigos activos
-    collectEnemyPerformanceData();
-
-    // obtener metricas de rendimiento de la oleada completa
-    DynamicArray<bool> reachedEnd = waveManager->getEnemiesReachedEnd();
-    DynamicArray<float> distancesTraveled = waveManager->getDistancesTraveled();
-    DynamicArray<float> damagesReceived = waveManager->getDamagesReceived();
-    DynamicArray<float> timesAlive = waveManager->getTimesAlive();
-
-    std::cout << "Datos de performance recopilados:\n";
-    std::cout << "- Enemigos que llegaron al final: " << reachedEnd.size() << "\n";
-    std::cout << "- Distancias: " << distancesTraveled.size() << "\n";
-    std::cout << "- Daños recibidos: " << damagesReceived.size() << "\n";
-    std::cout << "- Tiempos vivos: " << timesAlive.size() << "\n";
-
-    // calcular estadisticas de la oleada para debug
-    if (!damagesReceived.empty()) {
-        float avgDamage = 0.0f;
-        float maxDamage = 0.0f;
-        for (float damage : damagesReceived) {
-            avgDamage += damage;
-            maxDamage = std::max(maxDamage, damage);
-        }
-        avgDamage /= damagesReceived.size();
-
-        std::cout << "Estadísticas de daño - Promedio: " << avgDamage
-                  << ", Máximo: " << maxDamage << "\n";
-    }
-
-    std::cout << "Evaluando población con datos reales...\n";
-    // evaluar poblacion con datos reales de rendimiento
-    geneticsSystem->evaluatePopulation(reachedEnd, distancesTraveled, damagesReceived, timesAlive);
-
-    // mostrar fitness calculados para debug
-    std::cout << "=== FITNESS DESPUÉS DE EVALUAR ===\n";
-    DynamicArray<float> fitnessScores = geneticsSystem->getCurrentFitnessScores();
-    float totalFitness = 0.0f;
-    float maxFitness = 0.0f;
-    for (size_t i = 0; i < fitnessScores.size() && i < 5; ++i) {
-        std::cout << "Cromosoma " << i << ": " << fitnessScores[i] << "\n";
-        totalFitness += fitnessScores[i];
-        maxFitness = std::max(maxFitness, fitnessScores[i]);
-    }
-
-    if (!fitnessScores.empty()) {
-        float avgFitness = totalFitness / std::min(static_cast<size_t>(5), fitnessScores.size());
-        std::cout << "Fitness promedio (top 5): " << avgFitness
-                  << ", Fitness máximo: " << maxFitness << "\n";
-    }
-
-    std::cout << "Creando siguiente generación...\n";
-    // crear nueva generacion mediante seleccion, cruzamiento y mutacion
-    geneticsSystem->createNextGeneration();
-
-    // seleccionar mejores cromosomas para la siguiente oleada
-    int nextWaveSize = waveManager->getEnemiesPerWave();
-    DynamicArray<Chromosome> nextWaveChromosomes = geneticsSystem->getChromosomesForWave(nextWaveSize);
-
-    std::cout << "Cromosomas seleccionados para oleada: " << nextWaveChromosomes.size()
-              << " (necesarios: " << nextWaveSize << ")\n";
-
-    // configurar gestor de oleadas con nuevos cromosomas
-    waveManager->setWaveChromosomes(nextWaveChromosomes);
-
-    // comenzar la siguiente oleada
-    waveManager->startNextWave();
-
-    std::cout << "=== FIN prepareNextGeneration() ===\n";
+    std::cout << "=== PREPARANDO SIGUIENTE GENERACIÓN ===\n";
+    simulation->prepareNextGeneration();
+    updateStatsPanel();
 }
 
 
@@ -891,33 +627,18 @@ void GameplayState::render(sf::RenderWindow& window) {
 
     // dibujar cuadricula del juego
     if (gameGrid) {
-        gameGrid->draw(window);
+        gridRenderer.draw(window, *gameGrid, game->getFont());
     }
 
     // dibujar imagen de fondo decorativa
     window.draw(backgroundSprite);
 
     // dibujar proyectiles de todas las torres
-    for (const auto& row : gameGrid->getCells()) {
-        for (const auto& cell : row) {
-            if (cell.hasTower()) {
-                auto tower = cell.getTower();
-                if (tower->type() == "Archer") {
-                    std::dynamic_pointer_cast<Archer>(tower)->drawProjectiles(window);
-                }
-                if (tower->type() == "Mage") {
-                    std::dynamic_pointer_cast<Mage>(tower)->drawProjectiles(window);
-                }
-                if (tower->type() == "Gunner") {
-                    std::dynamic_pointer_cast<Gunner>(tower)->drawProjectiles(window);
-                }
-            }
-        }
-    }
+    projectileRenderer.draw(window);
 
     // dibujar todos los enemigos activos
-    for (const auto& enemy : enemies) {
-        window.draw(*enemy);
+    if (simulation) {
+        enemyRenderer.draw(window, simulation->getEnemies());
     }
 
     // dibujar botones de seleccion de torres
@@ -1021,50 +742,8 @@ void GameplayState::render(sf::RenderWindow& window) {
 // libera todos los recursos al salir del estado
 void GameplayState::cleanup() {
     stopMusic();
-    gameGrid.reset();
-    enemies.clear();
-    waveManager.reset();
-    geneticsSystem.reset();
-}
-
-
-
-// procesa los ataques de todas las torres hacia enemigos en rango
-void GameplayState::handleTowerAttacks(float dt) {
-    const auto& cellGrid = gameGrid->getCells();
-
-    for (const auto& row : cellGrid) {
-        for (const auto& cell : row) {
-            if (cell.hasTower()) {
-                auto tower = cell.getTower();
-
-                // actualizar proyectiles de cada tipo de torre
-                if (tower->type() == "Archer") {
-                    std::dynamic_pointer_cast<Archer>(tower)->updateProjectiles(dt);
-                }
-                if (tower->type() == "Mage") {
-                    std::dynamic_pointer_cast<Mage>(tower)->updateProjectiles(dt);
-                }
-                if (tower->type() == "Gunner") {
-                    std::dynamic_pointer_cast<Gunner>(tower)->updateProjectiles(dt);
-                }
-
-                // buscar enemigos en rango de ataque
-                for (const auto& enemyPtr : enemies) {
-                    if (enemyPtr->isAlive()) {
-                        float dx = enemyPtr->getPosition().x - cell.getPosition().x;
-                        float dy = enemyPtr->getPosition().y - cell.getPosition().y;
-                        float distance = std::hypot(dx, dy);
-
-                        if (distance <= tower->getRange()) {
-                            tower->attack(*enemyPtr, enemies);
-                            break; // solo un ataque por ciclo
-                        }
-                    }
-                }
-            }
-        }
-    }
+    gameGrid = nullptr;
+    simulation.reset();
 }
 
 
@@ -40,6 +40,7 @@ void CreditsState::init() {
     );
 
     exitButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -37,6 +37,7 @@ void ManualState::init() {
   );
 
   exitButton->setTextures(
+    game->getTextureCache(),
     "assets/images/buttons/boton_deselected.png",
     "assets/images/buttons/boton_selected.png"
   );
@@ -30,9 +30,11 @@ void MenuState::init() {
 
     ///// FONDO /////
     // cargar la textura de fondo
-    if (!backgroundTexture.loadFromFile("assets/images/backgrounds/background.png")) {
+    auto& textures = game->getTextureCache();
+    if (!textures.load("assets/images/backgrounds/background.png")) {
         std::cerr << "error al cargar la imagen de fondo" << std::endl;
     }
+    const sf::Texture& backgroundTexture = textures.get("assets/images/backgrounds/background.png");
     backgroundSprite.setTexture(backgroundTexture);
 
     // ajustar la escala para cubrir toda la ventana
@@ -44,10 +46,10 @@ void MenuState::init() {
 
     ///// LOGO /////
     // cargar el logo
-    if (!logoTexture.loadFromFile("assets/images/logo.png")) {
+    if (!textures.load("assets/images/logo.png")) {
         std::cerr << "error al cargar el logo" << std::endl;
     }
-    logoSprite.setTexture(logoTexture);
+    logoSprite.setTexture(textures.get("assets/images/logo.png"));
 
     // posicionar el logo en la parte superior central
     sf::FloatRect logoBounds = logoSprite.getLocalBounds();
@@ -112,6 +114,7 @@ void MenuState::init() {
         }
     );
     playButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -127,6 +130,7 @@ void MenuState::init() {
         }
     );
     settingsButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -142,6 +146,7 @@ void MenuState::init() {
         }
     );
     manualButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -157,6 +162,7 @@ void MenuState::init() {
         }
     );
     creditsButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -171,6 +177,7 @@ void MenuState::init() {
         }
     );
     exitButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -26,9 +26,11 @@ void SettingsState::init() {
 
     // fondo
     // cargar la textura de fondo
-    if (!backgroundTexture.loadFromFile("assets/images/backgrounds/background_menus.png")) {
+    auto& textures = game->getTextureCache();
+    if (!textures.load("assets/images/backgrounds/background_menus.png")) {
         std::cerr << "error al cargar la imagen de fondo" << std::endl;
     }
+    const sf::Texture& backgroundTexture = textures.get("assets/images/backgrounds/background_menus.png");
     backgroundSprite.setTexture(backgroundTexture);
 
     // ajustar la escala para cubrir toda la ventana
@@ -144,6 +146,7 @@ void SettingsState::init() {
     );
 
     exitButton->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
     );
@@ -73,6 +73,7 @@ void PauseState::init() {
         }
     ));
     buttons[0]->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
 );
@@ -88,6 +89,7 @@ void PauseState::init() {
         }
     ));
     buttons[1]->setTextures(
+        game->getTextureCache(),
         "assets/images/buttons/boton_deselected.png",
         "assets/images/buttons/boton_selected.png"
 );
@@ -0,0 +1,155 @@
+#include "../include/DataStructures/LinearArena.h"
+#include "../include/Game/Genetics/Genetics.h"
+#include "../include/Game/Grid/Grid.h"
+#include "../include/Game/Systems/FlowField.h"
+#include "../include/Game/Systems/Pathfinding.h"
+#include "../include/Game/Systems/RandomService.h"
+#include "../include/Game/Systems/Simulation.h"
+#include "../include/Game/Systems/TowerLayout.h"
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// contador global de pedidos al heap, reemplaza new y delete de todo el programa
+static size_t heapAllocations = 0;
+
+void* operator new(size_t bytes) {
+    heapAllocations++;
+    if (void* block = std::malloc(bytes ? bytes : 1)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept {
+    std::free(block);
+}
+
+
+
+// resultado de repetir un cuadro de temporales
+struct FrameResult {
+    double allocationsPerFrame;
+    double microsecondsPerFrame;
+};
+
+
+
+// ejecuta frame una vez para calentar y luego mide pedidos al heap y tiempo por cuadro
+// con arena, la arena se limpia al final de cada cuadro como lo haria el ciclo de simulacion
+template<typename Frame>
+static FrameResult measure(int frames, LinearArena* arena, Frame frame) {
+    frame(static_cast<MemoryResource*>(arena));
+    if (arena) arena->reset();
+
+    size_t before = heapAllocations;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        frame(static_cast<MemoryResource*>(arena));
+        if (arena) arena->reset();
+    }
+    double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+
+    return {static_cast<double>(heapAllocations - before) / frames, micros / frames};
+}
+
+
+
+// imprime una fila comparando heap contra arena para el mismo cuadro
+template<typename Frame>
+static void compare(const std::string& name, int frames, Frame frame) {
+    LinearArena arena;
+    FrameResult heap = measure(frames, nullptr, frame);
+    FrameResult linear = measure(frames, &arena, frame);
+
+    std::cout << name << ",heap," << heap.allocationsPerFrame << ',' << heap.microsecondsPerFrame << "\n";
+    std::cout << name << ",arena," << linear.allocationsPerFrame << ',' << linear.microsecondsPerFrame << "\n";
+}
+
+
+
+// cuenta pedidos al heap de pasos completos de simulacion despues de calentar
+// el calentamiento deja crecer pools, arena y colas hasta su tamano estable, despues no debe pedirse memoria
+static size_t countSimulationSteps(const std::string& layoutPath, float warmupSeconds, int steps) {
+    std::streambuf* coutBuffer = std::cout.rdbuf(nullptr);
+
+    Simulation simulation(0.0f, 0.0f, 11, 20, 70.0f);
+    DynamicArray<TowerPlacement> placements;
+    if (TowerLayout::loadFromFile(layoutPath, placements)) {
+        TowerLayout::apply(simulation, placements);
+    }
+    simulation.start();
+
+    const float timestep = 1.0f / 60.0f;
+    for (float elapsed = 0.0f; elapsed < warmupSeconds; elapsed += timestep) {
+        simulation.step(timestep);
+        simulation.clearEvents();
+    }
+
+    size_t before = heapAllocations;
+    int startWave = simulation.getWaveManager().getCurrentWave();
+    for (int i = 0; i < steps; i++) {
+        simulation.step(timestep);
+        simulation.clearEvents();
+    }
+    size_t allocations = heapAllocations - before;
+
+    std::cout.rdbuf(coutBuffer);
+    std::cout << "pasos_simulacion,arena," << static_cast<double>(allocations) / steps
+              << ",oleadas " << startWave << "-" << simulation.getWaveManager().getCurrentWave()
+              << ",arena " << simulation.getFrameArena().getHighWater() << " bytes\n";
+    return allocations;
+}
+
+
+
+// compara pedidos al heap por cuadro de los temporales de seleccion y rutas, con y sin arena
+// y verifica que los pasos de simulacion estables no pidan memoria, retorna 1 si alguno lo hace
+// uso: gk_bench_allocations [cuadros] [poblacion] [distribucion] [segundos_calentamiento] [pasos]
+int main(int argc, char* argv[]) {
+    int frames = argc > 1 ? std::stoi(argv[1]) : 2000;
+    int populationSize = argc > 2 ? std::stoi(argv[2]) : 200;
+    std::string layoutPath = argc > 3 ? argv[3] : "assets/layouts/default.txt";
+    float warmupSeconds = argc > 4 ? std::stof(argv[4]) : 300.0f;
+    int steps = argc > 5 ? std::stoi(argv[5]) : 30000;
+
+    // silenciar el registro de genetics, escribir a la consola no es lo que se mide
+    std::streambuf* coutBuffer = std::cout.rdbuf(nullptr);
+    RandomService random(RandomService::DEFAULT_SEED);
+    Genetics genetics(populationSize, 0.25f, 0.85f, random);
+    std::cout.rdbuf(coutBuffer);
+
+    Grid grid(0.0f, 0.0f, 64, 64, 10.0f);
+    FlowField field;
+    field.compute(&grid, Pathfinding::gridToWorld(32, 63, &grid));
+    sf::Vector2f start = Pathfinding::gridToWorld(32, 0, &grid);
+
+    std::cout << "cuadro,memoria,pedidos_por_cuadro,us_por_cuadro\n";
+
+    compare("seleccion_padres", frames, [&](MemoryResource* resource) {
+        std::streambuf* buffer = std::cout.rdbuf(nullptr);
+        DynamicArray<Chromosome> parents = genetics.selectParents(resource);
+        std::cout.rdbuf(buffer);
+        return parents.size();
+    });
+
+    compare("ruta_campo_flujo", frames, [&](MemoryResource* resource) {
+        DynamicArray<sf::Vector2f> path(resource);
+        field.extractPath(start, path);
+        return path.size();
+    });
+
+    size_t stepAllocations = countSimulationSteps(layoutPath, warmupSeconds, steps);
+    if (stepAllocations > 0) {
+        std::cout << "ERROR: " << stepAllocations << " pedidos al heap en " << steps << " pasos estables\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "../include/Game/Genetics/PopulationStore.h"
+#include "../include/Game/Systems/LaneRandom.h"
+#include "../include/DataStructures/SimdLanes.h"
+#include <iostream>
+#include <chrono>
+#include <string>
+
+// mide individuos por segundo al cruzar y mutar una generacion completa
+// compara el recorrido por objeto de Chromosome con el plan por carriles y el kernel por columnas
+// uso: gk_bench_breeding [repeticiones] [individuos maximos]
+int main(int argc, char* argv[]) {
+    int repeats = argc > 1 ? std::stoi(argv[1]) : 20;
+    int maxIndividuals = argc > 2 ? std::stoi(argv[2]) : 1 << 18;
+    const float mutationRate = 0.25f;
+    const float crossoverRate = 0.85f;
+
+    RandomStream random(RandomService::DEFAULT_SEED);
+    LaneRandom lanes;
+    float checksum = 0.0f;
+
+    std::cout << "variante: " << simdLanesName() << "\n";
+    std::cout << "individuos,por_objeto_por_s,por_carriles_por_s,aceleracion\n";
+
+    for (int count = 1024; count <= maxIndividuals; count *= 4) {
+        // poblacion con fitness repartido entre los tres factores de mutacion
+        PopulationStore parents;
+        DynamicArray<Chromosome> parentObjects;
+        DynamicArray<int> parentRows;
+        for (int i = 0; i < count; i++) {
+            Chromosome chromosome(random);
+            chromosome.setFitness(random.range(0.0f, 500.0f));
+            parents.push_back(chromosome);
+            parentObjects.push_back(chromosome);
+            parentRows.push_back(i);
+        }
+
+        // camino anterior: un objeto a la vez con distribuciones de <random>
+        DynamicArray<Chromosome> children;
+        children.reserve(count);
+        std::uniform_int_distribution<int> parentDist(0, count - 1);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            children.clear();
+            for (int i = 0; i < count; i++) {
+                const Chromosome& first = parentObjects[parentDist(random)];
+                const Chromosome& second = parentObjects[parentDist(random)];
+                Chromosome child = chance(random) < crossoverRate ? first.crossover(second, random) : first;
+                child.mutate(mutationRate, random);
+                children.push_back(child);
+            }
+            checksum += children[count / 2].getHealth();
+        }
+        double objectSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        // camino por carriles: sorteo de todo el plan y kernel de cruce y mutacion por columnas
+        BreedingPlan plan;
+        PopulationStore offspring;
+        offspring.resize(count);
+
+        begin = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            plan.drawBatch(lanes, parentRows, parents, crossoverRate, mutationRate, count);
+            offspring.breed(parents, plan, 0);
+            checksum += offspring.getGene(Gene::Health)[count / 2];
+        }
+        double laneSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        double objectRate = static_cast<double>(count) * repeats / objectSeconds;
+        double laneRate = static_cast<double>(count) * repeats / laneSeconds;
+        std::cout << count << ',' << objectRate << ',' << laneRate << ',' << (laneRate / objectRate) << "\n";
+    }
+
+    // evita que el compilador descarte los resultados
+    std::cerr << "control: " << checksum << "\n";
+    return 0;
+}
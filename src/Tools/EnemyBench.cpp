@@ -0,0 +1,57 @@
+#include "../include/Game/Enemies/EnemyStore.h"
+#include "../include/Game/Enemies/Ogre.h"
+#include "../include/Game/Enemies/Harpy.h"
+#include "../include/Game/Systems/RandomService.h"
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+
+// mide cuanto tarda un paso de movimiento con muchos enemigos simultaneos
+// uso: gk_bench_enemies [pasos] [enemigos maximos]
+int main(int argc, char* argv[]) {
+    int steps = argc > 1 ? std::stoi(argv[1]) : 200;
+    int maxEnemies = argc > 2 ? std::stoi(argv[2]) : 20000;
+    const float timestep = 1.0f / 60.0f;
+
+    // camino largo en zigzag para que ningun enemigo llegue al final durante la medicion
+    DynamicArray<sf::Vector2f> path;
+    for (int i = 0; i < 2000; i++) {
+        path.push_back(sf::Vector2f(i * 70.0f, (i % 2) * 70.0f));
+    }
+
+    RandomStream random(RandomService::DEFAULT_SEED);
+
+    std::cout << "enemigos,pasos,ms_por_paso,enemigos_por_ms\n";
+
+    for (int count = 1000; count <= maxEnemies; count *= 2) {
+        EnemyStore store;
+        DynamicArray<std::unique_ptr<Enemy>> enemies;
+        for (int i = 0; i < count; i++) {
+            sf::Vector2f start(random.range(0.0f, 500.0f), random.range(0.0f, 70.0f));
+            std::unique_ptr<Enemy> enemy;
+            if (i % 2 == 0) {
+                enemy = std::make_unique<Ogre>(start, path);
+            } else {
+                enemy = std::make_unique<Harpy>(start, path);
+            }
+            store.attach(*enemy);
+            enemies.push_back(std::move(enemy));
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int step = 0; step < steps; step++) {
+            store.advance(timestep);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count() / steps;
+
+        std::cout << count << ',' << steps << ',' << ms << ',' << (count / ms) << "\n";
+
+        // liberar desde el final para no desplazar filas
+        for (size_t i = enemies.size(); i > 0; i--) {
+            enemies[i - 1].reset();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,274 @@
+#include "../include/Game/Systems/Simulation.h"
+#include "../include/Game/Systems/TowerLayout.h"
+#include "../include/Game/Systems/PopulationEvaluator.h"
+#include "../include/Game/Systems/Logger.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+
+// parametros de una corrida de evolucion por lotes
+struct EvolveOptions {
+    std::string layoutFile;
+    std::string outputFile = "evolution.csv";
+    int generations = 1000;
+    int populationSize = 20;
+    float mutationRate = 0.25f;
+    float crossoverRate = 0.85f;
+    float timestep = 1.0f / 60.0f;
+    float maxWaveTime = 300.0f;
+    uint64_t seed = RandomService::DEFAULT_SEED;
+    bool verbose = false;
+    bool parallel = false;
+    bool sequentialBreeding = false;
+    SelectionStrategy selection = SelectionStrategy::Roulette;
+    int threads = 0;
+    int trialWave = 0;
+};
+
+// dimensiones de la cuadricula del juego
+const int GRID_ROWS = 11;
+const int GRID_COLS = 20;
+const float CELL_SIZE = 70.0f;
+
+
+
+// muestra las opciones disponibles
+static void printUsage(const char* program) {
+    std::cerr << "Uso: " << program << " --layout <archivo> [opciones]\n"
+              << "  --layout <archivo>       distribucion de torres (fila columna tipo [nivel])\n"
+              << "  --out <archivo>          csv de salida (por defecto evolution.csv)\n"
+              << "  --generations <n>        generaciones a simular (por defecto 1000)\n"
+              << "  --population <n>         tamano de la poblacion (por defecto 20)\n"
+              << "  --mutation <tasa>        tasa de mutacion inicial (por defecto 0.25)\n"
+              << "  --crossover <tasa>       tasa de cruzamiento inicial (por defecto 0.85)\n"
+              << "  --seed <n>               semilla de la corrida\n"
+              << "  --timestep <s>           paso fijo de simulacion (por defecto 1/60)\n"
+              << "  --max-wave-time <s>      limite de tiempo simulado por oleada (por defecto 300)\n"
+              << "  --parallel               evaluar cada cromosoma en su propia simulacion, en paralelo\n"
+              << "  --threads <n>            hilos para --parallel (por defecto todos los nucleos)\n"
+              << "  --trial-wave <n>         oleada fija usada por --parallel (por defecto generacion + 1)\n"
+              << "  --selection <modo>       ruleta de padres: roulette, alias o sus (por defecto roulette)\n"
+              << "  --sequential-breeding    sortear los hijos uno a uno como antes de los kernels por carriles\n"
+              << "  --verbose                mostrar el registro detallado de la simulacion\n";
+}
+
+
+
+// interpreta los argumentos de la linea de comandos
+static bool parseArguments(int argc, char* argv[], EvolveOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--verbose") {
+            options.verbose = true;
+            continue;
+        }
+        if (arg == "--parallel") {
+            options.parallel = true;
+            continue;
+        }
+        if (arg == "--sequential-breeding") {
+            options.sequentialBreeding = true;
+            continue;
+        }
+
+        // el resto de opciones requieren un valor
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--layout") options.layoutFile = value;
+            else if (arg == "--out") options.outputFile = value;
+            else if (arg == "--generations") options.generations = std::stoi(value);
+            else if (arg == "--population") options.populationSize = std::stoi(value);
+            else if (arg == "--mutation") options.mutationRate = std::stof(value);
+            else if (arg == "--crossover") options.crossoverRate = std::stof(value);
+            else if (arg == "--seed") options.seed = std::stoull(value);
+            else if (arg == "--timestep") options.timestep = std::stof(value);
+            else if (arg == "--max-wave-time") options.maxWaveTime = std::stof(value);
+            else if (arg == "--threads") options.threads = std::stoi(value);
+            else if (arg == "--trial-wave") options.trialWave = std::stoi(value);
+            else if (arg == "--selection") {
+                if (value == "roulette") options.selection = SelectionStrategy::Roulette;
+                else if (value == "alias") options.selection = SelectionStrategy::Alias;
+                else if (value == "sus") options.selection = SelectionStrategy::StochasticUniversal;
+                else {
+                    std::cerr << "Seleccion desconocida: " << value << "\n";
+                    return false;
+                }
+            }
+            else {
+                std::cerr << "Opcion desconocida: " << arg << "\n";
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Valor invalido para " << arg << ": " << value << "\n";
+            return false;
+        }
+    }
+
+    return !options.layoutFile.empty() && options.generations > 0 &&
+           options.populationSize > 1 && options.timestep > 0.0f;
+}
+
+
+
+// escribe una fila del csv con el resumen de la generacion
+static void writeRow(std::ofstream& csv, const GenerationStats& stats, bool finished, double simTime) {
+    csv << stats.generation << ',' << stats.wave << ',' << stats.enemies << ','
+        << stats.reachedEnd << ',' << stats.averageFitness << ',' << stats.bestFitness << ','
+        << stats.diversity << ',' << stats.mutationRate << ',' << stats.mutationCount << ','
+        << (finished ? 0 : 1) << ',' << simTime << ',' << stats.peakEnemies << '\n';
+}
+
+
+
+// reporta progreso de vez en cuando
+static void reportProgress(int done, int total, const GenerationStats& stats) {
+    if (done % 100 == 0 || done == total) {
+        std::cerr << "Generacion " << done << "/" << total
+                  << " - mejor fitness: " << stats.bestFitness
+                  << ", diversidad: " << stats.diversity << "\n";
+    }
+}
+
+
+
+// modo secuencial: una sola simulacion donde cada oleada evalua a la poblacion, igual que en el juego
+static double runLive(const EvolveOptions& options, const DynamicArray<TowerPlacement>& placements, std::ofstream& csv) {
+    Simulation simulation(0.0f, 0.0f, GRID_ROWS, GRID_COLS, CELL_SIZE,
+                          options.populationSize, options.mutationRate, options.crossoverRate,
+                          1.5f, options.seed);
+    simulation.setRecordEvents(false);
+    simulation.setAutoAdvanceGenerations(false);
+    if (options.sequentialBreeding) {
+        simulation.getGenetics().setBreedingMode(BreedingMode::Sequential);
+    }
+    simulation.getGenetics().setSelectionStrategy(options.selection);
+
+    int placed = TowerLayout::apply(simulation, placements);
+    std::cerr << "Torres colocadas: " << placed << "/" << placements.size()
+              << ", semilla: " << simulation.getSeed() << "\n";
+
+    simulation.start();
+
+    for (int i = 0; i < options.generations; i++) {
+        bool finished = simulation.runUntilWaveEnds(options.timestep, options.maxWaveTime);
+        simulation.prepareNextGeneration();
+
+        const GenerationStats& stats = simulation.getLastGenerationStats();
+        writeRow(csv, stats, finished, simulation.getTime());
+        reportProgress(i + 1, options.generations, stats);
+    }
+
+    return simulation.getTime();
+}
+
+
+
+// modo paralelo: cada cromosoma se evalua en su propia oleada aislada, repartidas entre los nucleos
+static double runParallel(const EvolveOptions& options, const DynamicArray<TowerPlacement>& placements, std::ofstream& csv) {
+    TrialConfig config;
+    config.rows = GRID_ROWS;
+    config.cols = GRID_COLS;
+    config.cellSize = CELL_SIZE;
+    config.timestep = options.timestep;
+    config.maxTrialTime = options.maxWaveTime;
+
+    PopulationEvaluator evaluator(placements, config, options.threads);
+    RandomService random(options.seed);
+    Genetics genetics(options.populationSize, options.mutationRate, options.crossoverRate, random);
+    genetics.setPathTotalLength(evaluator.getPathLength());
+    if (options.sequentialBreeding) {
+        genetics.setBreedingMode(BreedingMode::Sequential);
+    }
+    genetics.setSelectionStrategy(options.selection);
+
+    std::cerr << "Torres colocadas: " << evaluator.getTowerCount() << "/" << placements.size()
+              << ", semilla: " << random.getSeed()
+              << ", hilos: " << evaluator.getThreadCount() << "\n";
+
+    double simTime = 0.0;
+    for (int i = 0; i < options.generations; i++) {
+        int wave = options.trialWave > 0 ? options.trialWave : i + 1;
+        uint64_t generationSeed = RandomService::mixSeed(options.seed, static_cast<uint64_t>(i));
+        DynamicArray<EnemyPerformance> results = evaluator.evaluate(genetics, wave, generationSeed);
+
+        GenerationStats stats;
+        stats.generation = genetics.getGeneration();
+        stats.wave = wave;
+        stats.enemies = static_cast<int>(results.size());
+        bool finished = true;
+        for (const auto& result : results) {
+            if (result.reachedEnd) stats.reachedEnd++;
+            simTime += result.timeAlive;
+            if (result.timeAlive >= options.maxWaveTime) finished = false;
+        }
+        stats.averageFitness = genetics.getAverageFitness();
+        stats.bestFitness = genetics.getBestChromosome().getFitness();
+        stats.diversity = genetics.getDiversityMetric();
+        stats.peakEnemies = 1; // cada prueba aislada tiene un solo enemigo
+
+        genetics.createNextGeneration();
+        stats.mutationRate = genetics.getMutationRate();
+        stats.mutationCount = genetics.getMutationCount();
+
+        writeRow(csv, stats, finished, simTime);
+        reportProgress(i + 1, options.generations, stats);
+    }
+
+    return simTime;
+}
+
+
+
+// ejecuta generaciones del algoritmo genetico contra una distribucion fija de torres sin interfaz
+int main(int argc, char* argv[]) {
+    EvolveOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    DynamicArray<TowerPlacement> placements;
+    if (!TowerLayout::loadFromFile(options.layoutFile, placements)) {
+        return 1;
+    }
+
+    std::ofstream csv(options.outputFile);
+    if (!csv.is_open()) {
+        std::cerr << "Error creando " << options.outputFile << "\n";
+        return 1;
+    }
+
+    // silenciar el registro de la simulacion, escribir miles de lineas por oleada domina el tiempo
+    // los mensajes del registro asincrono ni se encolan, y con --verbose se muestran tambien los de debug
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    if (!options.verbose) {
+        Logger::instance().setLevel(LogLevel::Off);
+        std::cout.rdbuf(nullptr);
+    } else {
+        Logger::instance().setLevel(LogLevel::Debug);
+    }
+
+    csv << "generation,wave,enemies,reached_end,avg_fitness,best_fitness,diversity,"
+           "mutation_rate,mutations,timed_out,sim_time,peak_enemies\n";
+
+    auto startTime = std::chrono::steady_clock::now();
+    double simTime = options.parallel ? runParallel(options, placements, csv)
+                                      : runLive(options, placements, csv);
+
+    // el hilo del registro no debe escribir mientras se cambia el buffer de la consola
+    Logger::instance().flush();
+    std::cout.rdbuf(coutBuffer);
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::cerr << "Completado en " << elapsed << "s (" << (options.generations / elapsed)
+              << " generaciones/s, " << (simTime / elapsed) << "x tiempo real)\n";
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "../include/Game/Systems/Logger.h"
+#include <iostream>
+#include <chrono>
+#include <string>
+
+// flujo que descarta todo, asi solo se mide dar formato y no la consola
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int character) override { return character; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+
+
+// mide nanosegundos por mensaje en rafagas que caben en el anillo
+// el tiempo de escribir entre rafagas no cuenta, es trabajo del hilo de fondo
+template<typename Call>
+static double measure(int messages, Call call) {
+    const int burst = 2048;
+    double nanos = 0.0;
+
+    for (int done = 0; done < messages; done += burst) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < burst; i++) {
+            call(done + i);
+        }
+        nanos += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+        Logger::instance().flush();
+    }
+
+    return nanos / messages;
+}
+
+
+
+// compara el costo por mensaje de escribir directo a un flujo contra el registro asincrono
+// uso: gk_bench_logger [mensajes]
+int main(int argc, char* argv[]) {
+    int messages = argc > 1 ? std::stoi(argv[1]) : 1 << 20;
+
+    NullBuffer nullBuffer;
+    std::ostream nullStream(&nullBuffer);
+    Logger& logger = Logger::instance();
+    logger.setOutput(nullStream);
+
+    std::cout << "modo,ns_por_mensaje\n";
+
+    double direct = measure(messages, [&](int i) {
+        nullStream << "Enemigo " << i << " recibió " << 25.1181f << " de daño. Total acumulado: " << i * 0.5f << "\n";
+    });
+    std::cout << "flujo_directo," << direct << "\n";
+
+    logger.setLevel(LogLevel::Debug);
+    double enabled = measure(messages, [&](int i) {
+        logger.log(LogLevel::Debug, "Enemigo {} recibió {} de daño. Total acumulado: {}", i, 25.1181f, i * 0.5f);
+    });
+    std::cout << "registro_activo," << enabled << "\n";
+
+    logger.setLevel(LogLevel::Info);
+    double filtered = measure(messages, [&](int i) {
+        logger.log(LogLevel::Debug, "Enemigo {} recibió {} de daño. Total acumulado: {}", i, 25.1181f, i * 0.5f);
+    });
+    std::cout << "registro_filtrado," << filtered << "\n";
+
+    std::cout << "descartados," << logger.getDroppedCount() << "\n";
+
+    logger.setOutput(std::cout);
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "../include/Game/Systems/Pathfinding.h"
+#include "../include/Game/Grid/Grid.h"
+#include "../include/Game/Towers/Archer.h"
+#include "../include/Game/Systems/RandomService.h"
+#include <iostream>
+#include <chrono>
+#include <string>
+
+// mide consultas a* por segundo en cuadriculas grandes con obstaculos aleatorios
+// uso: gk_bench_pathfinding [consultas por tamano] [densidad de obstaculos]
+int main(int argc, char* argv[]) {
+    int queries = argc > 1 ? std::stoi(argv[1]) : 200;
+    float density = argc > 2 ? std::stof(argv[2]) : 0.25f;
+    const float cellSize = 10.0f;
+    const int sizes[] = {64, 256, 512, 1024};
+
+    RandomStream random(RandomService::DEFAULT_SEED);
+    auto tower = std::make_shared<Archer>();
+
+    std::cout << "tamano,consultas,encontradas,longitud_media,consultas_por_segundo\n";
+
+    for (int size : sizes) {
+        Grid grid(0.0f, 0.0f, size, size, cellSize);
+
+        // bloquear celdas al azar con la misma torre compartida
+        for (int row = 0; row < size; row++) {
+            for (int col = 0; col < size; col++) {
+                if (random.nextFloat() < density) {
+                    grid.placeTower(row, col, tower);
+                }
+            }
+        }
+
+        // generar pares de inicio y objetivo antes de medir
+        DynamicArray<sf::Vector2f> starts;
+        DynamicArray<sf::Vector2f> goals;
+        for (int i = 0; i < queries; i++) {
+            starts.push_back(Pathfinding::gridToWorld(random.rangeInt(0, size - 1), random.rangeInt(0, size - 1), &grid));
+            goals.push_back(Pathfinding::gridToWorld(random.rangeInt(0, size - 1), random.rangeInt(0, size - 1), &grid));
+        }
+
+        // una consulta de calentamiento para dimensionar el espacio de trabajo
+        Pathfinding::findPath(&grid, starts[0], goals[0]);
+
+        int found = 0;
+        size_t totalLength = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < queries; i++) {
+            auto path = Pathfinding::findPath(&grid, starts[i], goals[i]);
+            if (!path.empty()) {
+                found++;
+                totalLength += path.size();
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        std::cout << size << "x" << size << ',' << queries << ',' << found << ','
+                  << (found > 0 ? static_cast<double>(totalLength) / found : 0.0) << ','
+                  << (queries / seconds) << "\n";
+    }
+
+    return 0;
+}
@@ -28,16 +28,17 @@ Button::Button(float x, float y, float width, float height,
 
 
 
-// establecer la textura del boton
-void Button::setTextures(const std::string& normalTexture, const std::string& selectedTexture) {
-    if (buttonTexture.loadFromFile(normalTexture) &&
-        buttonSelectedTexture.loadFromFile(selectedTexture)) {
+// establecer la textura del boton, compartida con los demas botones a traves del cache
+void Button::setTextures(TextureCache& textures, const std::string& normalTexture, const std::string& selectedTexture) {
+    if (textures.load(normalTexture) && textures.load(selectedTexture)) {
+        buttonTexture = &textures.get(normalTexture);
+        buttonSelectedTexture = &textures.get(selectedTexture);
 
         useTexture = true;
 
         // configuramos la textura para que se ajuste al tamaño del botón
-        shape.setTexture(&buttonTexture);
-        shape.setTextureRect(sf::IntRect(0, 0, buttonTexture.getSize().x, buttonTexture.getSize().y));
+        shape.setTexture(buttonTexture);
+        shape.setTextureRect(sf::IntRect(0, 0, buttonTexture->getSize().x, buttonTexture->getSize().y));
         }
 }
 
@@ -70,9 +71,9 @@ void Button::activate() {
 void Button::draw(sf::RenderWindow& window) {
     if (useTexture) {
         if (isSelected) {
-            shape.setTexture(&buttonSelectedTexture);
+            shape.setTexture(buttonSelectedTexture);
         } else {
-            shape.setTexture(&buttonTexture);
+            shape.setTexture(buttonTexture);
         }
     }
 